@@ -0,0 +1,518 @@
+/*
+File 7: CSRFunctions.h
+Written By:
+1- Edward Assaf (all of it) (iterative counterparts of 'GraphFunctions.h' working on CSRGraph or CompressedGraph)
+*/
+
+#pragma once
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include "LinkedList.h"
+#include "CSRGraph.h"
+#include "Memory.h"
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//preallocated scratch state of the traversals below, reusable by any number of calls on graphs of at most n vertices
+//every traversal resets the parts it uses, so nothing has to be cleared between calls
+//the arrays come from 'allocateArray' and are first touched by the thread that runs the traversals
+template<typename Graph>
+class Workspace {
+public:
+	ll n; //capacity in vertices
+	ll* dfs_numbers; //index of each vertex in order of discovery (-1 -> undiscovered)
+	ll* parent; //parent of each vertex in the depth-first-search tree
+	ll* components; //components array filled by 'gabow'
+	bool* flags; //'inOstack' in 'gabow', 'visited' in 'isBiconnected'
+	std::vector<ll> ostack, rstack, order;
+	std::vector<std::pair<ll, typename Graph::Iterator>> search; //simulated call stack
+	std::vector<ll> queue, next_queue; //frontiers of the top-down steps of 'reachesAll'
+	std::vector<unsigned long long> seen, frontier, next; //bitsets of 'reachesAll' (bit i of word i / 64 -> vertex i)
+	//constructor
+	Workspace(const ll& vertices) : n(vertices) {
+		dfs_numbers = allocateArray<ll>(n + 1); parent = allocateArray<ll>(n + 1); components = allocateArray<ll>(n + 1);
+		flags = allocateArray<bool>(n + 1, true);
+		ostack.reserve(n); rstack.reserve(n); order.reserve(n); search.reserve(n);
+		queue.reserve(n); next_queue.reserve(n);
+		seen.reserve(n / 64 + 1); frontier.reserve(n / 64 + 1); next.reserve(n / 64 + 1);
+	}
+	Workspace(const Workspace&) = delete;
+	Workspace& operator=(const Workspace&) = delete;
+	//destructor
+	~Workspace() { releaseArray(dfs_numbers); releaseArray(parent); releaseArray(components); releaseArray(flags); }
+};
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- discovers strongly connected components in a directed graph using 'Cheriyan-Mehlhorn-Gabow' algorithm
+- iterative version of 'gabow' (no recursion, safe for deep depth-first-search trees)
+- returns workspace.components where arr[i] = x -> vertex i is a part of component x (removed vertices get -1)
+PARAMETERS:
+- graph: the directed graph
+- removed: a boolean array of deleted vertices (removed[i] = true -> vertex i is ignored), nullptr deletes nothing
+- workspace: the scratch state (at least graph.n vertices)
+*/
+template<typename Graph>
+ll* gabow(Graph& graph, const bool* removed, Workspace<Graph>& workspace) {
+	ll dfs_counter = 0;
+	ll* dfs_numbers = workspace.dfs_numbers;
+	ll* components = workspace.components;
+	bool* inOstack = workspace.flags;
+	std::fill(dfs_numbers, dfs_numbers + graph.n, -1);
+	std::fill(components, components + graph.n, -1);
+	std::fill(inOstack, inOstack + graph.n, false);
+	std::vector<ll>& ostack = workspace.ostack, &rstack = workspace.rstack;
+	std::vector<std::pair<ll, typename Graph::Iterator>>& search = workspace.search; //simulated call stack of 'gabow_dfs'
+	ostack.clear(); rstack.clear(); search.clear();
+	for (ll i = 0; i < graph.n; i++) {
+		if (dfs_numbers[i] != -1 || (removed && removed[i])) continue;
+		dfs_numbers[i] = dfs_counter++;
+		ostack.push_back(i); rstack.push_back(i); inOstack[i] = true;
+		search.push_back({ i, graph.neighbours(i) });
+		while (!search.empty()) {
+			ll vertex = search.back().first;
+			typename Graph::Iterator& itr = search.back().second;
+			if (itr.valid()) {
+				ll next = itr.value(); itr.next();
+				if (itr.valid()) { prefetch(dfs_numbers + itr.value()); graph.prefetchOffset(itr.value()); } //the following neighbour
+				if (removed && removed[next]) continue;
+				if (dfs_numbers[next] == -1) {
+					dfs_numbers[next] = dfs_counter++;
+					ostack.push_back(next); rstack.push_back(next); inOstack[next] = true;
+					search.push_back({ next, graph.neighbours(next) });
+				}
+				else if (inOstack[next]) while (dfs_numbers[next] < dfs_numbers[rstack.back()]) rstack.pop_back();
+				continue;
+			}
+			search.pop_back();
+			if (vertex != rstack.back()) continue;
+			rstack.pop_back();
+			while (!ostack.empty()) {
+				ll w = ostack.back(); ostack.pop_back();
+				inOstack[w] = false;
+				components[w] = vertex;
+				if (w == vertex) break;
+			}
+		}
+	}
+	return components;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- same as the previous 'gabow' with a scratch state of its own
+- returns a new array where arr[i] = x -> vertex i is a part of component x (removed vertices get -1)
+PARAMETERS:
+- graph: the directed graph
+- removed: a boolean array of deleted vertices (removed[i] = true -> vertex i is ignored), nullptr deletes nothing
+*/
+template<typename Graph>
+ll* gabow(Graph& graph, const bool* removed = nullptr) {
+	Workspace<Graph> workspace(graph.n);
+	ll* components = new ll[graph.n];
+	gabow(graph, removed, workspace);
+	std::copy(workspace.components, workspace.components + graph.n, components);
+	return components;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- groups the vertices of a components array by component
+- returns a vector of components where each component is a vector of its vertices in ascending order
+PARAMETERS:
+- components: an array that represents vertices' components (components[i] = x -> vertex i is a part of component x, -1 is skipped)
+- vertices: the number of vertices in the graph
+*/
+std::vector<std::vector<ll>> groupComponents(ll*& components, const ll& vertices) {
+	std::vector<ll> index(vertices, -1);
+	std::vector<std::vector<ll>> groups;
+	for (ll i = 0; i < vertices; i++) {
+		if (components[i] == -1) continue;
+		if (index[components[i]] == -1) { index[components[i]] = groups.size(); groups.push_back({}); }
+		groups[index[components[i]]].push_back(i);
+	}
+	return groups;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- checks the strong-connectivity of a directed graph using the 'Cheriyan-Mehlhorn-Gabow' algorithm
+- returns true if the graph (without removed vertices) is strongly connected, and false otherwise
+PARAMETERS:
+- graph: the directed graph
+- removed: a boolean array of deleted vertices (removed[i] = true -> vertex i is ignored), nullptr deletes nothing
+- workspace: the scratch state (at least graph.n vertices)
+*/
+template<typename Graph>
+bool isStronglyConnected(Graph& graph, const bool* removed, Workspace<Graph>& workspace) {
+	ll* components = gabow(graph, removed, workspace);
+	ll representative = -1;
+	for (ll i = 0; i < graph.n; i++) {
+		if (components[i] == -1) continue;
+		if (representative == -1) representative = components[i];
+		if (components[i] != representative) return false;
+	}
+	return true;
+}
+
+//same as the previous 'isStronglyConnected' with a scratch state of its own
+template<typename Graph>
+bool isStronglyConnected(Graph& graph, const bool* removed = nullptr) {
+	Workspace<Graph> workspace(graph.n);
+	return isStronglyConnected(graph, removed, workspace);
+}
+
+const ll TOP_DOWN_ALPHA = 14; //'reachesAll' goes bottom-up once the frontier has more than 1/14 of the unexplored edges
+const ll BOTTOM_UP_BETA = 24; //'reachesAll' goes back top-down once the frontier has less than 1/24 of the vertices
+
+//returns the index of the lowest set bit of a non-zero word
+inline ll lowestBit(const unsigned long long& word) {
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward64(&index, word);
+	return index;
+#else
+	return __builtin_ctzll(word);
+#endif
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- direction-optimizing breadth-first search ('Beamer-Asanovic-Patterson') from a root over the vertices that are not removed
+- top-down steps expand a queue of frontier vertices through their out-neighbours, bottom-up steps (used while the frontier is
+  heavy) let every unseen vertex look for a frontier vertex among its in-neighbours, the seen and frontier sets are bitsets
+- stops as soon as every vertex is reached, or as soon as the frontier dies out (some vertex is then certainly unreachable)
+- returns true if every vertex that is not removed is reachable from the root, and false otherwise
+PARAMETERS:
+- graph: the directed graph
+- reversed: the reverse of the graph (see 'reverseCSR')
+- removed: a boolean array of deleted vertices (removed[i] = true -> vertex i is ignored), nullptr deletes nothing
+- root: the start vertex (not removed)
+- vertices: the number of vertices that are not removed
+- workspace: the scratch state (at least graph.n vertices)
+*/
+template<typename Graph>
+bool reachesAll(Graph& graph, Graph& reversed, const bool* removed, const ll& root, const ll& vertices, Workspace<Graph>& workspace) {
+	ll words = (graph.n + 63) / 64;
+	std::vector<unsigned long long>& seen = workspace.seen, &frontier = workspace.frontier, &next = workspace.next;
+	std::vector<ll>& queue = workspace.queue, &next_queue = workspace.next_queue;
+	seen.assign(words, 0);
+	if (graph.n % 64) seen[words - 1] = ~0ULL << (graph.n % 64); //bits past the last vertex count as seen
+	if (removed) for (ll i = 0; i < graph.n; i++) if (removed[i]) seen[i / 64] |= 1ULL << (i % 64);
+	seen[root / 64] |= 1ULL << (root % 64);
+	queue.assign(1, root);
+	ll reached = 1, frontier_size = 1, frontier_edges = graph.degree(root), unexplored_edges = graph.m - frontier_edges;
+	bool bottom_up = false;
+	while (reached < vertices) {
+		if (frontier_size == 0) return false;
+		if (!bottom_up && frontier_edges * TOP_DOWN_ALPHA > unexplored_edges) { //queue -> bitset
+			frontier.assign(words, 0);
+			for (auto& v : queue) frontier[v / 64] |= 1ULL << (v % 64);
+			bottom_up = true;
+		}
+		else if (bottom_up && frontier_size * BOTTOM_UP_BETA < graph.n) { //bitset -> queue
+			queue.clear();
+			for (ll w = 0; w < words; w++) {
+				for (unsigned long long bits = frontier[w]; bits; bits &= bits - 1) queue.push_back(w * 64 + lowestBit(bits));
+			}
+			bottom_up = false;
+		}
+		ll added = 0, added_edges = 0;
+		if (!bottom_up) {
+			next_queue.clear();
+			for (ll k = 0; k < ll(queue.size()); k++) {
+				if (k + PREFETCH_DISTANCE < ll(queue.size())) graph.prefetchOffset(queue[k + PREFETCH_DISTANCE]);
+				if (k + PREFETCH_DISTANCE / 2 < ll(queue.size())) graph.prefetchRow(queue[k + PREFETCH_DISTANCE / 2]);
+				for (typename Graph::Iterator itr = graph.neighbours(queue[k]); itr.valid(); itr.next()) {
+					ll u = itr.value();
+					if (seen[u / 64] >> (u % 64) & 1) continue;
+					seen[u / 64] |= 1ULL << (u % 64);
+					next_queue.push_back(u);
+					added_edges += graph.degree(u);
+				}
+			}
+			added = next_queue.size();
+			queue.swap(next_queue);
+		}
+		else {
+			next.assign(words, 0);
+			for (ll w = 0; w < words; w++) {
+				for (unsigned long long bits = ~seen[w]; bits; bits &= bits - 1) {
+					ll v = w * 64 + lowestBit(bits);
+					for (typename Graph::Iterator itr = reversed.neighbours(v); itr.valid(); itr.next()) {
+						ll u = itr.value();
+						if (!(frontier[u / 64] >> (u % 64) & 1)) continue;
+						next[w] |= 1ULL << (v % 64);
+						added++; added_edges += graph.degree(v);
+						break;
+					}
+				}
+			}
+			for (ll w = 0; w < words; w++) seen[w] |= next[w];
+			frontier.swap(next);
+		}
+		reached += added; frontier_size = added; frontier_edges = added_edges; unexplored_edges -= added_edges;
+	}
+	return true;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- checks the strong-connectivity of a directed graph by forward and backward reachability from one root ('reachesAll' on the
+  graph and on its reverse), which answers the same question as 'gabow' without computing the components
+- use it whenever only the verdict is needed, and 'gabow' when the components themselves are needed
+- returns true if the graph (without removed vertices) is strongly connected, and false otherwise
+PARAMETERS:
+- graph: the directed graph
+- reversed: the reverse of the graph (see 'reverseCSR')
+- removed: a boolean array of deleted vertices (removed[i] = true -> vertex i is ignored), nullptr deletes nothing
+- workspace: the scratch state (at least graph.n vertices)
+*/
+template<typename Graph>
+bool isStronglyConnected(Graph& graph, Graph& reversed, const bool* removed, Workspace<Graph>& workspace) {
+	ll vertices = 0, root = -1;
+	for (ll i = 0; i < graph.n; i++) {
+		if (removed && removed[i]) continue;
+		vertices++;
+		if (root == -1) root = i;
+	}
+	if (vertices <= 1) return true;
+	return reachesAll(graph, reversed, removed, root, vertices, workspace) && reachesAll(reversed, graph, removed, root, vertices, workspace);
+}
+
+//same as the previous 'isStronglyConnected' with a scratch state of its own
+template<typename Graph>
+bool isStronglyConnected(Graph& graph, Graph& reversed, const bool* removed = nullptr) {
+	Workspace<Graph> workspace(graph.n);
+	return isStronglyConnected(graph, reversed, removed, workspace);
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- uses the 'Jens Schmidt' chain decomposition to determine if an undirected graph is biconnected or not
+- iterative version of 'isBiconnected' that builds chains by climbing tree edges instead of redirecting the graph
+- returns true if the graph (without removed vertices) is biconnected, and false otherwise
+PARAMETERS:
+- undirected: the undirected graph (symmetric CSRGraph without junk edges, see 'makeUndirected')
+- removed: a boolean array of deleted vertices (removed[i] = true -> vertex i is ignored), nullptr deletes nothing
+- workspace: the scratch state (at least undirected.n vertices)
+*/
+template<typename Graph>
+bool isBiconnected(Graph& undirected, const bool* removed, Workspace<Graph>& workspace) {
+	ll vertices = 0, root = -1, edges = 0;
+	for (ll i = 0; i < undirected.n; i++) {
+		if (removed && removed[i]) continue;
+		vertices++;
+		if (root == -1) root = i;
+	}
+	if (vertices == 0) return true;
+	ll* dfs_numbers = workspace.dfs_numbers;
+	ll* parent = workspace.parent;
+	std::fill(dfs_numbers, dfs_numbers + undirected.n, -1);
+	std::vector<ll>& order = workspace.order; //vertices in ascending order of discovery
+	std::vector<std::pair<ll, typename Graph::Iterator>>& search = workspace.search;
+	order.clear(); search.clear();
+	dfs_numbers[root] = 0; parent[root] = -1; order.push_back(root);
+	search.push_back({ root, undirected.neighbours(root) });
+	while (!search.empty()) {
+		ll vertex = search.back().first;
+		typename Graph::Iterator& itr = search.back().second;
+		if (!itr.valid()) { search.pop_back(); continue; }
+		ll next = itr.value(); itr.next();
+		if (itr.valid()) { prefetch(dfs_numbers + itr.value()); undirected.prefetchOffset(itr.value()); } //the following neighbour
+		if (removed && removed[next]) continue;
+		edges++;
+		if (dfs_numbers[next] != -1) continue;
+		dfs_numbers[next] = order.size(); parent[next] = vertex; order.push_back(next);
+		search.push_back({ next, undirected.neighbours(next) });
+	}
+	edges /= 2;
+	bool biconnected = (ll(order.size()) == vertices);
+	if (biconnected && vertices > 2) {
+		bool* visited = workspace.flags;
+		std::fill(visited, visited + undirected.n, false);
+		ll covered_edges = 0;
+		bool first_chain = true;
+		for (ll k = 0; k < vertices && biconnected; k++) {
+			ll vertex = order[k];
+			if (k + PREFETCH_DISTANCE < vertices) undirected.prefetchOffset(order[k + PREFETCH_DISTANCE]); //rows of the coming vertices
+			if (k + PREFETCH_DISTANCE / 2 < vertices) undirected.prefetchRow(order[k + PREFETCH_DISTANCE / 2]);
+			for (typename Graph::Iterator itr = undirected.neighbours(vertex); itr.valid(); itr.next()) {
+				ll next = itr.value();
+				if (removed && removed[next]) continue;
+				//backward edges (vertex,next) are those leading to a descendant through a non-tree edge
+				if (dfs_numbers[next] < dfs_numbers[vertex] || parent[next] == vertex) continue;
+				visited[vertex] = true;
+				covered_edges++;
+				ll current = next;
+				while (!visited[current]) { visited[current] = true; current = parent[current]; covered_edges++; }
+				if (current == vertex && !first_chain) { biconnected = false; break; } //a cycle other than the first chain
+				first_chain = false;
+			}
+		}
+		biconnected = biconnected && (covered_edges == edges);
+	}
+	return biconnected;
+}
+
+//same as the previous 'isBiconnected' with a scratch state of its own
+template<typename Graph>
+bool isBiconnected(Graph& undirected, const bool* removed = nullptr) {
+	Workspace<Graph> workspace(undirected.n);
+	return isBiconnected(undirected, removed, workspace);
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- discovers the biconnected components (blocks) of an undirected graph using 'Hopcroft-Tarjan' lowpoints
+- returns a vector of blocks where each block is a vector of its vertices (articulation points appear in several blocks)
+- isolated vertices are not reported
+PARAMETERS:
+- undirected: the undirected graph (symmetric CSRGraph without junk edges, see 'makeUndirected')
+- removed: a boolean array of deleted vertices (removed[i] = true -> vertex i is ignored), nullptr deletes nothing
+*/
+template<typename Graph>
+std::vector<std::vector<ll>> biconnectedBlocks(Graph& undirected, const bool* removed = nullptr) {
+	std::vector<std::vector<ll>> blocks;
+	ll dfs_counter = 0;
+	ll* dfs_numbers = new ll[undirected.n];
+	ll* low = new ll[undirected.n];
+	std::fill(dfs_numbers, dfs_numbers + undirected.n, -1);
+	std::vector<ll> vstack;
+	std::vector<std::pair<ll, typename Graph::Iterator>> search;
+	for (ll i = 0; i < undirected.n; i++) {
+		if (dfs_numbers[i] != -1 || (removed && removed[i])) continue;
+		dfs_numbers[i] = low[i] = dfs_counter++;
+		vstack.push_back(i);
+		search.push_back({ i, undirected.neighbours(i) });
+		while (!search.empty()) {
+			ll vertex = search.back().first;
+			typename Graph::Iterator& itr = search.back().second;
+			if (itr.valid()) {
+				ll next = itr.value(); itr.next();
+				if (itr.valid()) { prefetch(dfs_numbers + itr.value()); undirected.prefetchOffset(itr.value()); } //the following neighbour
+				if (removed && removed[next]) continue;
+				if (dfs_numbers[next] == -1) {
+					dfs_numbers[next] = low[next] = dfs_counter++;
+					vstack.push_back(next);
+					search.push_back({ next, undirected.neighbours(next) });
+				}
+				else low[vertex] = std::min(low[vertex], dfs_numbers[next]);
+				continue;
+			}
+			search.pop_back();
+			if (search.empty()) { vstack.pop_back(); continue; } //root of the depth-first-search tree
+			ll parent = search.back().first;
+			low[parent] = std::min(low[parent], low[vertex]);
+			if (low[vertex] < dfs_numbers[parent]) continue;
+			std::vector<ll> block; //'parent' separates the subtree of 'vertex' from the rest of the graph
+			while (true) {
+				ll w = vstack.back(); vstack.pop_back();
+				block.push_back(w);
+				if (w == vertex) break;
+			}
+			block.push_back(parent);
+			blocks.push_back(block);
+		}
+	}
+	delete[] dfs_numbers; delete[] low;
+	return blocks;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- computes the immediate dominators of the flowgraph (graph, root) using the 'Cooper-Harvey-Kennedy' iterative algorithm
+- returns an array where arr[i] = x -> x is the immediate dominator of vertex i (arr[root] = root, unreachable vertices get -1)
+PARAMETERS:
+- graph: the directed graph
+- reversed: the reverse of the graph (see 'reverseCSR')
+- root: the start vertex of the flowgraph
+*/
+template<typename Graph>
+ll* dominators(Graph& graph, Graph& reversed, const ll& root) {
+	ll* idom = new ll[graph.n];
+	ll* postorder_numbers = new ll[graph.n];
+	std::fill(idom, idom + graph.n, -1);
+	std::fill(postorder_numbers, postorder_numbers + graph.n, -1);
+	std::vector<ll> postorder;
+	bool* visited = new bool[graph.n] {};
+	std::vector<std::pair<ll, typename Graph::Iterator>> search;
+	visited[root] = true;
+	search.push_back({ root, graph.neighbours(root) });
+	while (!search.empty()) {
+		ll vertex = search.back().first;
+		typename Graph::Iterator& itr = search.back().second;
+		if (!itr.valid()) {
+			postorder_numbers[vertex] = postorder.size();
+			postorder.push_back(vertex);
+			search.pop_back();
+			continue;
+		}
+		ll next = itr.value(); itr.next();
+		if (visited[next]) continue;
+		visited[next] = true;
+		search.push_back({ next, graph.neighbours(next) });
+	}
+	idom[root] = root;
+	bool changed = true;
+	while (changed) {
+		changed = false;
+		for (ll k = ll(postorder.size()) - 2; k >= 0; k--) { //reverse postorder without the root
+			ll vertex = postorder[k], candidate = -1;
+			for (typename Graph::Iterator itr = reversed.neighbours(vertex); itr.valid(); itr.next()) {
+				ll pred = itr.value();
+				if (idom[pred] == -1) continue;
+				if (candidate == -1) { candidate = pred; continue; }
+				ll a = pred, b = candidate; //intersects the dominator paths of 'pred' and 'candidate'
+				while (a != b) {
+					while (postorder_numbers[a] < postorder_numbers[b]) a = idom[a];
+					while (postorder_numbers[b] < postorder_numbers[a]) b = idom[b];
+				}
+				candidate = a;
+			}
+			if (idom[vertex] != candidate) { idom[vertex] = candidate; changed = true; }
+		}
+	}
+	delete[] postorder_numbers; delete[] visited;
+	return idom;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- finds the strong articulation points of a STRONGLY CONNECTED directed graph using dominators ('Italiano-Laura-Santaroni')
+- a vertex w is a strong articulation point if deleting it leaves the graph not strongly connected
+- returns the strong articulation points in ascending order
+PARAMETERS:
+- graph: the strongly connected directed graph
+- reversed: the reverse of the graph (see 'reverseCSR')
+*/
+template<typename Graph>
+std::vector<ll> strongArticulationPoints(Graph& graph, Graph& reversed) {
+	std::vector<ll> points;
+	if (graph.n < 3) return points;
+	bool* isPoint = new bool[graph.n] {};
+	bool* removed = new bool[graph.n] {};
+	removed[0] = true;
+	isPoint[0] = !isStronglyConnected(graph, reversed, removed);
+	ll* forward = dominators(graph, reversed, 0);
+	ll* backward = dominators(reversed, graph, 0);
+	for (ll i = 1; i < graph.n; i++) { //non-trivial dominators of G(0) and G^R(0)
+		if (forward[i] != 0) isPoint[forward[i]] = true;
+		if (backward[i] != 0) isPoint[backward[i]] = true;
+	}
+	for (ll i = 0; i < graph.n; i++) if (isPoint[i]) points.push_back(i);
+	delete[] isPoint; delete[] removed; delete[] forward; delete[] backward;
+	return points;
+}
@@ -0,0 +1,304 @@
+/*
+File 6: CSRGraph.h
+Written By:
+1- Edward Assaf (all of it)
+*/
+
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <functional>
+#include "LinkedList.h"
+#include "Memory.h"
+
+//provides a method of iterating over the neighbours of a vertex in a CSRGraph
+class CSRIterator {
+private:
+	ll* current; //pointer to the neighbour of current iteration
+	ll* last; //pointer past the last neighbour
+public:
+	//constructor
+	CSRIterator(ll* begin = nullptr, ll* end = nullptr) : current(begin), last(end) {}
+	//returns the neighbour of the current iteration
+	//invalid iterators will lead to exceptions
+	ll value() { return *current; }
+	//returns true if the iterator still references a neighbour
+	bool valid() { return current != last; }
+	//moves the iterator to the next iteration
+	void next() { current++; }
+};
+
+//represents a graph in compressed sparse row form
+//the neighbours of vertex v are targets[offsets[v]], ..., targets[offsets[v + 1] - 1] in ascending order
+//the arrays come from 'allocateArray' (huge pages for large graphs, see 'Memory.h')
+//warning: copies share the same arrays, call 'clear' exactly once per built graph
+class CSRGraph {
+public:
+	typedef CSRIterator Iterator;
+	ll n; //number of vertices
+	ll m; //number of edges
+	ll* offsets; //row offsets (n + 1 entries)
+	ll* targets; //edge targets (m entries)
+	//constructor
+	CSRGraph(const ll& vertices = 0, const ll& edges = 0) : n(vertices), m(edges), offsets(nullptr), targets(nullptr) {
+		offsets = allocateArray<ll>(n + 1, true);
+		targets = allocateArray<ll>(m);
+	}
+	//returns the number of neighbours of vertex v
+	ll degree(const ll& v) { return offsets[v + 1] - offsets[v]; }
+	//returns an iterator over the neighbours of vertex v
+	CSRIterator neighbours(const ll& v) { return CSRIterator(targets + offsets[v], targets + offsets[v + 1]); }
+	//prefetches the row offset of vertex v (cheap, call it well before 'neighbours(v)')
+	void prefetchOffset(const ll& v) { prefetch(offsets + v); }
+	//prefetches the first neighbours of vertex v (reads its row offset, call it after 'prefetchOffset(v)')
+	void prefetchRow(const ll& v) { prefetch(targets + offsets[v]); }
+	//frees the arrays of the graph
+	void clear() {
+		releaseArray(offsets); releaseArray(targets);
+		n = 0; m = 0;
+	}
+};
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- converts a graph represented by an adjacency list into a CSRGraph
+- neighbours will be sorted in ascending order, the adjacency list is left intact
+PARAMETERS:
+- adjList: the graph represented by an adjacency list
+- vertices: the number of vertices in the graph
+*/
+CSRGraph toCSR(LinkedList<ll>*& adjList, const ll& vertices) {
+	ll edges = 0;
+	for (ll i = 0; i < vertices; i++) edges += adjList[i].get_len();
+	CSRGraph graph(vertices, edges);
+	for (ll i = 0; i < vertices; i++) {
+		ll index = graph.offsets[i];
+		ListIterator<ll> itr(adjList[i].get_clone());
+		for (ll j = 0; j < adjList[i].get_len(); j++) {
+			graph.targets[index++] = itr.value();
+			itr.next();
+		}
+		graph.offsets[i + 1] = index;
+		std::sort(graph.targets + graph.offsets[i], graph.targets + index);
+	}
+	return graph;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- converts a list of edges into a CSRGraph using a counting sort
+- junk edges (duplicates and self-loops) will be discarded and neighbours will be sorted in ascending order
+PARAMETERS:
+- vertices: the number of vertices in the graph
+- edges: the edges (x,y) of the graph, where 0 <= x,y < vertices
+*/
+CSRGraph toCSR(const ll& vertices, const std::vector<std::pair<ll, ll>>& edges) {
+	std::vector<ll> row(vertices + 1, 0), cursor(vertices);
+	for (auto& e : edges) if (e.first != e.second) row[e.first + 1]++;
+	for (ll i = 0; i < vertices; i++) { row[i + 1] += row[i]; cursor[i] = row[i]; }
+	std::vector<ll> pairs(row[vertices]);
+	for (auto& e : edges) if (e.first != e.second) pairs[cursor[e.first]++] = e.second;
+	ll unique_edges = 0;
+	for (ll i = 0; i < vertices; i++) { //sorts and deduplicates each row in place
+		std::sort(pairs.begin() + row[i], pairs.begin() + row[i + 1]);
+		cursor[i] = std::unique(pairs.begin() + row[i], pairs.begin() + row[i + 1]) - (pairs.begin() + row[i]);
+		unique_edges += cursor[i];
+	}
+	CSRGraph graph(vertices, unique_edges);
+	for (ll i = 0; i < vertices; i++) {
+		graph.offsets[i + 1] = graph.offsets[i] + cursor[i];
+		std::copy(pairs.begin() + row[i], pairs.begin() + row[i] + cursor[i], graph.targets + graph.offsets[i]);
+	}
+	return graph;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- converts a CSRGraph into a graph represented by an adjacency list (useful for running 'GraphFunctions.h' on it)
+PARAMETERS:
+- graph: the graph
+*/
+LinkedList<ll>* toAdjList(CSRGraph& graph) {
+	LinkedList<ll>* adjList = new LinkedList<ll>[graph.n];
+	for (ll i = 0; i < graph.n; i++) {
+		for (ll j = graph.offsets[i + 1] - 1; j >= graph.offsets[i]; j--) adjList[i].push_front(graph.targets[j]);
+	}
+	return adjList;
+}
+
+//frees every node of a linked list and leaves it empty (LinkedList has no destructor, dropped lists keep their nodes)
+//warning: the nodes must not be shared with another list (copies of a LinkedList share its nodes)
+void releaseList(LinkedList<ll>& list) {
+	while (list.get_len()) list.pop_front();
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- frees a graph represented by an adjacency list (every node and the array of lists) and resets the pointer
+PARAMETERS:
+- adjList: the graph represented by an adjacency list
+- vertices: the number of vertices in the graph
+*/
+void releaseAdjList(LinkedList<ll>*& adjList, const ll& vertices) {
+	if (!adjList) return;
+	for (ll i = 0; i < vertices; i++) releaseList(adjList[i]);
+	delete[] adjList;
+	adjList = nullptr;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- runs task(begin, end) on up to 'threads' threads, each thread getting a consecutive range that splits [0, count)
+PARAMETERS:
+- threads: the number of threads (1 runs the task on the calling thread)
+- count: the size of the range
+- task: the work of one range
+*/
+void parallelFor(const ll& threads, const ll& count, const std::function<void(ll, ll)>& task) {
+	ll parts = std::max(1LL, std::min(threads, count));
+	if (parts == 1) { task(0, count); return; }
+	std::vector<std::thread> pool;
+	for (ll t = 0; t < parts; t++) pool.emplace_back(task, count * t / parts, count * (t + 1) / parts);
+	for (auto& t : pool) t.join();
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- returns the reverse of a directed graph (every edge (x,y) becomes (y,x)) using a parallel counting sort
+- every thread counts the targets of its own range of rows in a count array of its own, a prefix sum over (row, thread)
+  gives each thread a private slice of every reversed row, and the thread fills its slices with plain stores
+- neighbours of the result are sorted in ascending order (threads own ascending ranges of rows)
+- every thread costs a count array of graph.n integers, so the number of threads is capped at the average degree: the
+  count arrays together never take more memory than the targets of the graph
+PARAMETERS:
+- graph: the directed graph
+- threads: the number of threads to use (at most)
+*/
+CSRGraph reverseCSR(CSRGraph& graph, const ll& threads = 1) {
+	ll n = graph.n;
+	CSRGraph reversed(n, graph.m);
+	ll parts = std::max(1LL, std::min({ threads, n, graph.m / std::max(1LL, n) }));
+	std::vector<std::vector<ll>> cursor(parts);
+	parallelFor(parts, parts, [&](ll first, ll last) { //counts the targets of each range
+		for (ll t = first; t < last; t++) {
+			cursor[t].assign(n, 0);
+			for (ll j = graph.offsets[n * t / parts]; j < graph.offsets[n * (t + 1) / parts]; j++) cursor[t][graph.targets[j]]++;
+		}
+	});
+	for (ll i = 0; i < n; i++) { //turns the counts into the first slot of each (row, range) slice
+		ll slot = reversed.offsets[i];
+		for (ll t = 0; t < parts; t++) { ll count = cursor[t][i]; cursor[t][i] = slot; slot += count; }
+		reversed.offsets[i + 1] = slot;
+	}
+	parallelFor(parts, parts, [&](ll first, ll last) { //fills the slices
+		for (ll t = first; t < last; t++) {
+			for (ll i = n * t / parts; i < n * (t + 1) / parts; i++) {
+				for (ll j = graph.offsets[i]; j < graph.offsets[i + 1]; j++) reversed.targets[cursor[t][graph.targets[j]]++] = i;
+			}
+		}
+	});
+	return reversed;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- merges two rows of neighbours sorted in ascending order into one, dropping duplicates and one vertex to skip
+- returns the length of the merged row
+PARAMETERS:
+- a, a_end, b, b_end: the two rows
+- skip: a vertex left out of the merged row (the owner of the row, so no self-loop is created)
+- row: where to write the merged row (nullptr only counts it)
+*/
+ll mergeRows(const ll* a, const ll* a_end, const ll* b, const ll* b_end, const ll& skip, ll* row) {
+	ll length = 0, last = -1;
+	while (a != a_end || b != b_end) {
+		ll v = (b == b_end || (a != a_end && *a <= *b)) ? *a++ : *b++;
+		if (v == skip || v == last) continue;
+		if (row) row[length] = v;
+		length++; last = v;
+	}
+	return length;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- returns the underlying undirected graph of a directed graph as a symmetric CSRGraph
+- every edge (x,y) is stored as both (x,y) and (y,x), junk edges (duplicates and self-loops) will be discarded
+- built by sort-and-merge: the rows of the graph and of its reverse (see 'reverseCSR') are both sorted, so row x of the
+  result is the linear merge of the two rows of x, done in parallel over the rows (once to size the rows, once to fill them)
+- the directed graph and its reverse are left intact
+PARAMETERS:
+- graph: the directed graph (rows sorted in ascending order, as every CSRGraph builder produces)
+- reversed: the reverse of the graph (see 'reverseCSR'), pass it when it is needed afterwards anyway (as by 'sweep')
+- threads: the number of threads to use
+*/
+CSRGraph makeUndirected(CSRGraph& graph, CSRGraph& reversed, const ll& threads = 1) {
+	ll n = graph.n;
+	std::vector<ll> degree(n);
+	auto merge = [&](const ll& i, ll* row) {
+		return mergeRows(graph.targets + graph.offsets[i], graph.targets + graph.offsets[i + 1],
+			reversed.targets + reversed.offsets[i], reversed.targets + reversed.offsets[i + 1], i, row);
+	};
+	parallelFor(threads, n, [&](ll begin, ll end) { for (ll i = begin; i < end; i++) degree[i] = merge(i, nullptr); });
+	ll edges = 0;
+	for (ll i = 0; i < n; i++) edges += degree[i];
+	CSRGraph undirected(n, edges);
+	for (ll i = 0; i < n; i++) undirected.offsets[i + 1] = undirected.offsets[i] + degree[i];
+	parallelFor(threads, n, [&](ll begin, ll end) { //first touch of the rows by the threads that own them
+		for (ll i = begin; i < end; i++) merge(i, undirected.targets + undirected.offsets[i]);
+	});
+	return undirected;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- same as the previous 'makeUndirected', building the reverse of the graph and releasing it afterwards
+PARAMETERS:
+- graph: the directed graph (rows sorted in ascending order, as every CSRGraph builder produces)
+- threads: the number of threads to use
+*/
+CSRGraph makeUndirected(CSRGraph& graph, const ll& threads = 1) {
+	CSRGraph reversed = reverseCSR(graph, threads);
+	CSRGraph undirected = makeUndirected(graph, reversed, threads);
+	reversed.clear();
+	return undirected;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- extracts the subgraph induced by a set of vertices as an individual CSRGraph
+- vertex members[i] of the graph becomes vertex i of the subgraph
+PARAMETERS:
+- graph: the graph
+- members: the vertices of the subgraph
+- encoder: an array of size graph.n filled with -1, it is restored to that state before returning
+*/
+CSRGraph inducedSubgraph(CSRGraph& graph, const std::vector<ll>& members, ll*& encoder) {
+	ll vertices = members.size(), edges = 0;
+	for (ll i = 0; i < vertices; i++) encoder[members[i]] = i;
+	for (ll i = 0; i < vertices; i++) {
+		for (CSRIterator itr = graph.neighbours(members[i]); itr.valid(); itr.next()) edges += (encoder[itr.value()] != -1);
+	}
+	CSRGraph subgraph(vertices, edges);
+	ll index = 0;
+	for (ll i = 0; i < vertices; i++) {
+		for (CSRIterator itr = graph.neighbours(members[i]); itr.valid(); itr.next()) {
+			if (encoder[itr.value()] != -1) subgraph.targets[index++] = encoder[itr.value()];
+		}
+		subgraph.offsets[i + 1] = index;
+		std::sort(subgraph.targets + subgraph.offsets[i], subgraph.targets + index);
+	}
+	for (ll i = 0; i < vertices; i++) encoder[members[i]] = -1;
+	return subgraph;
+}
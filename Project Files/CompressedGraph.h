@@ -0,0 +1,379 @@
+/*
+File 14: CompressedGraph.h
+Written By:
+1- Edward Assaf (all of it)
+*/
+
+#pragma once
+#include <string>
+#include <vector>
+#include <fstream>
+#include <functional>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include "LinkedList.h"
+#include "DatasetReader.h"
+#include "CSRGraph.h"
+#include "Memory.h"
+
+const ll ANCHOR_INTERVAL = 8; //a CompressedGraph stores the byte position of the row of one vertex out of ANCHOR_INTERVAL
+
+//reads a 'varint' (7 bits per byte, lowest first) and moves the pointer past it
+inline unsigned long long readVarint(const unsigned char*& current) {
+	unsigned long long value = 0;
+	int shift = 0;
+	while (*current & 0x80) { value |= (unsigned long long)(*current++ & 0x7F) << shift; shift += 7; }
+	return value | ((unsigned long long)(*current++) << shift);
+}
+
+//appends the 'varint' encoding of a value to a byte buffer
+inline void writeVarint(std::vector<unsigned char>& buffer, unsigned long long value) {
+	while (value >= 0x80) { buffer.push_back((unsigned char)(value | 0x80)); value >>= 7; }
+	buffer.push_back((unsigned char)value);
+}
+
+//returns the number of bytes of the 'varint' encoding of a value
+inline ll varintSize(unsigned long long value) {
+	ll size = 1;
+	while (value >= 0x80) { value >>= 7; size++; }
+	return size;
+}
+
+//provides a method of iterating over the neighbours of a vertex in a CompressedGraph, decoding them on the fly
+class CompressedIterator {
+private:
+	const unsigned char* current; //pointer to the encoding of the next neighbour
+	const unsigned char* last; //pointer past the encoding of the last neighbour
+	ll neighbour; //the neighbour of the current iteration
+	bool first; //true until the first neighbour is decoded (it is stored relative to the vertex of the row)
+	bool ended; //true once every neighbour was visited
+	//decodes the next gap and adds it to the current neighbour
+	void decode() {
+		if (current == last) { ended = true; return; }
+		unsigned long long gap = readVarint(current);
+		if (first) { neighbour += ll(gap >> 1) ^ -ll(gap & 1); first = false; } //'zigzag' encoding of a signed gap
+		else neighbour += gap;
+	}
+public:
+	//constructor
+	CompressedIterator(const unsigned char* begin = nullptr, const unsigned char* end = nullptr, const ll& origin = 0)
+		: current(begin), last(end), neighbour(origin), first(true), ended(false) {
+		decode();
+	}
+	//returns the neighbour of the current iteration
+	ll value() { return neighbour; }
+	//returns true if the iterator still references a neighbour
+	bool valid() { return !ended; }
+	//moves the iterator to the next iteration
+	void next() { decode(); }
+};
+
+//represents a graph whose sorted neighbour lists are stored as gaps in 'varint' encoding (7 bits per byte)
+//every row starts with its length in bytes, then the first neighbour relative to the vertex itself (signed, so local
+//edges take a single byte) and the gaps between the following neighbours
+//instead of an offset per vertex only the position of every ANCHOR_INTERVAL-th row is kept, the rows in between are
+//reached by skipping the lengths of the rows before them, so the graph costs about 2 bytes per vertex plus its gaps
+//an empty graph (the default) holds no arrays
+//warning: copies share the same arrays, call 'clear' exactly once per built graph
+class CompressedGraph {
+public:
+	typedef CompressedIterator Iterator;
+	ll n; //number of vertices
+	ll m; //number of edges
+	ll length; //number of encoded bytes
+	ll* anchors; //anchors[k] is the byte position of the row of vertex k * ANCHOR_INTERVAL (n / ANCHOR_INTERVAL + 1 entries)
+	unsigned char* bytes; //encoded rows (length bytes)
+	//constructor
+	CompressedGraph(const ll& vertices = 0) : n(vertices), m(0), length(0), anchors(nullptr), bytes(nullptr) {
+		if (n <= 0) return;
+		anchors = allocateArray<ll>(n / ANCHOR_INTERVAL + 1, true);
+		bytes = allocateArray<unsigned char>(1);
+	}
+	//returns a pointer to the row of vertex v (its length comes first)
+	const unsigned char* row(const ll& v) {
+		const unsigned char* current = bytes + anchors[v / ANCHOR_INTERVAL];
+		for (ll k = v - v % ANCHOR_INTERVAL; k < v; k++) {
+			unsigned long long size = readVarint(current);
+			current += size;
+		}
+		return current;
+	}
+	//returns the number of neighbours of vertex v (decodes the row)
+	ll degree(const ll& v) {
+		const unsigned char* current = row(v);
+		unsigned long long size = readVarint(current);
+		const unsigned char* last = current + size;
+		ll count = 0;
+		for (; current != last; current++) count += !(*current & 0x80);
+		return count;
+	}
+	//returns an iterator over the neighbours of vertex v
+	CompressedIterator neighbours(const ll& v) {
+		const unsigned char* current = row(v);
+		unsigned long long size = readVarint(current);
+		return CompressedIterator(current, current + size, v);
+	}
+	//prefetches the anchor of vertex v (cheap, call it well before 'neighbours(v)')
+	void prefetchOffset(const ll& v) { prefetch(anchors + v / ANCHOR_INTERVAL); }
+	//prefetches the rows around the anchor of vertex v (reads its anchor, call it after 'prefetchOffset(v)')
+	void prefetchRow(const ll& v) { prefetch(bytes + anchors[v / ANCHOR_INTERVAL]); }
+	//returns the number of bytes used by the graph
+	ll memory() { return (n / ANCHOR_INTERVAL + 1) * sizeof(ll) + length; }
+	//frees the arrays of the graph
+	void clear() {
+		releaseArray(anchors); releaseArray(bytes);
+		n = 0; m = 0; length = 0;
+	}
+};
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- appends the encoding of a sorted row of neighbours (its length in bytes, then its gaps) to a byte buffer
+PARAMETERS:
+- buffer: the byte buffer
+- v: the vertex of the row
+- begin, end: the row of neighbours in ascending order without duplicates
+*/
+void encodeRow(std::vector<unsigned char>& buffer, const ll& v, const ll* begin, const ll* end) {
+	auto gap = [&](const ll* itr) -> unsigned long long {
+		if (itr != begin) return *itr - *(itr - 1);
+		ll first = *itr - v;
+		return ((unsigned long long)first << 1) ^ (unsigned long long)(first >> 63); //'zigzag' encoding of a signed gap
+	};
+	ll size = 0;
+	for (const ll* itr = begin; itr != end; itr++) size += varintSize(gap(itr));
+	writeVarint(buffer, size);
+	for (const ll* itr = begin; itr != end; itr++) writeVarint(buffer, gap(itr));
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- moves an encoded byte buffer into a CompressedGraph whose anchors are already filled
+PARAMETERS:
+- graph: the compressed graph
+- buffer: the encoded rows (emptied)
+*/
+void attachBytes(CompressedGraph& graph, std::vector<unsigned char>& buffer) {
+	releaseArray(graph.bytes);
+	graph.bytes = allocateArray<unsigned char>(buffer.size());
+	std::copy(buffer.begin(), buffer.end(), graph.bytes);
+	graph.length = buffer.size();
+	std::vector<unsigned char>().swap(buffer);
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- converts a CSRGraph into a CompressedGraph (the CSRGraph is left intact)
+PARAMETERS:
+- graph: the graph (neighbours sorted in ascending order without duplicates, as every CSRGraph builder produces)
+*/
+CompressedGraph compress(CSRGraph& graph) {
+	CompressedGraph compressed(graph.n);
+	compressed.m = graph.m;
+	std::vector<unsigned char> buffer;
+	buffer.reserve(graph.m * 2);
+	for (ll i = 0; i < graph.n; i++) {
+		if (i % ANCHOR_INTERVAL == 0) compressed.anchors[i / ANCHOR_INTERVAL] = buffer.size();
+		encodeRow(buffer, i, graph.targets + graph.offsets[i], graph.targets + graph.offsets[i + 1]);
+	}
+	attachBytes(compressed, buffer);
+	return compressed;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- builds a CompressedGraph row range by row range, so only the rows of one range are ever held uncompressed
+- the edges are produced by a single call of 'collect', so the source is read once whatever the number of ranges: when
+  the rows exceed the budget, every edge is spilled to a temporary file of its range and each range is read back in turn
+- the rows of each range are then sorted, deduplicated, stripped of self-loops and encoded
+- throws std::runtime_error if a temporary file cannot be created
+PARAMETERS:
+- vertices: the number of vertices
+- bound: an upper bound on the length of each row before deduplication
+- budget: the maximum number of uncompressed neighbours held at once (rows longer than the budget get a range of their own)
+- collect: a function collect(emit) that calls emit(v, u) once for every neighbour u of every vertex v
+*/
+template<typename Collector>
+CompressedGraph buildCompressed(const ll& vertices, const std::vector<ll>& bound, const ll& budget, Collector collect) {
+	CompressedGraph compressed(vertices);
+	std::vector<ll> starts; //the first vertex of each range, then 'vertices'
+	for (ll lo = 0, hi = 0; lo < vertices; lo = hi) {
+		ll size = 0;
+		for (hi = lo; hi < vertices && (hi == lo || size + bound[hi] <= budget); hi++) size += bound[hi];
+		starts.push_back(lo);
+	}
+	ll ranges = starts.size();
+	starts.push_back(vertices);
+	std::vector<unsigned char> buffer;
+	std::vector<ll> row, cursor, start;
+	auto open = [&](const ll& k) { //prepares empty rows for the vertices of range k
+		ll lo = starts[k], hi = starts[k + 1];
+		cursor.assign(hi - lo, 0); start.assign(hi - lo + 1, 0);
+		for (ll v = lo; v < hi; v++) start[v - lo + 1] = start[v - lo] + bound[v];
+		for (ll v = lo; v < hi; v++) cursor[v - lo] = start[v - lo];
+		row.assign(start[hi - lo], 0);
+	};
+	auto encode = [&](const ll& k) { //encodes the collected rows of range k
+		ll lo = starts[k], hi = starts[k + 1];
+		for (ll v = lo; v < hi; v++) {
+			ll* begin = row.data() + start[v - lo], *end = row.data() + cursor[v - lo];
+			std::sort(begin, end);
+			end = std::unique(begin, end);
+			end = std::remove(begin, end, v);
+			if (v % ANCHOR_INTERVAL == 0) compressed.anchors[v / ANCHOR_INTERVAL] = buffer.size();
+			encodeRow(buffer, v, begin, end);
+			compressed.m += end - begin;
+		}
+	};
+	if (ranges == 1) { //everything fits in the budget, the rows are collected in place
+		open(0);
+		collect([&](const ll& v, const ll& u) { row[cursor[v]++] = u; });
+		encode(0);
+	}
+	else if (ranges > 1) {
+		std::vector<std::FILE*> spills(ranges, nullptr); //the edges of each range as pairs <v, u>
+		for (auto& spill : spills) {
+			spill = std::tmpfile();
+			if (spill) continue;
+			for (auto& opened : spills) if (opened) std::fclose(opened);
+			throw std::runtime_error("buildCompressed: could not create a temporary file");
+		}
+		collect([&](const ll& v, const ll& u) {
+			ll edge[2] = { v, u };
+			std::fwrite(edge, sizeof(ll), 2, spills[std::upper_bound(starts.begin(), starts.end(), v) - starts.begin() - 1]);
+		});
+		for (ll k = 0; k < ranges; k++) {
+			open(k);
+			std::rewind(spills[k]);
+			ll edge[2];
+			while (std::fread(edge, sizeof(ll), 2, spills[k]) == 2) row[cursor[edge[0] - starts[k]]++] = edge[1];
+			std::fclose(spills[k]);
+			encode(k);
+		}
+	}
+	attachBytes(compressed, buffer);
+	return compressed;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- reads a SNAP .txt dataset file straight into a CompressedGraph, without an adjacency list or a CSRGraph in between
+- vertices are numbered, labelled and hashed exactly as 'readFile' does, junk edges (duplicates and self-loops) are discarded
+- the file is read twice: once to number the vertices and once to collect the edges (see 'buildCompressed')
+- returns true if file is read successfully and false otherwise
+PARAMETERS:
+- file_path: the path of the .txt dataset
+- graph: an empty graph that will store the compressed directed graph
+- labels: a vector that will store the dataset's id of each vertex (labels[i] = x -> vertex i is vertex x in the file)
+- hash: an integer that will store the canonical hash of the graph (the one of 'readFile')
+- budget: the maximum number of uncompressed neighbours held at once
+*/
+bool readCompressed(const std::string& file_path, CompressedGraph& graph, std::vector<ll>& labels, unsigned long long& hash,
+	const ll& budget = 1LL << 24) {
+	auto scan = [&](const std::function<void(const ll&, const ll&)>& visit) {
+		std::ifstream datasetReader(file_path);
+		if (!datasetReader.is_open()) return false;
+		std::string line;
+		for (ll i = 0; i < 4; i++) std::getline(datasetReader, line); //get rid of junk lines
+		while (std::getline(datasetReader, line)) {
+			ll i = 0;
+			ll fromVertex = extract(line, i);
+			ll toVertex = extract(line, i);
+			visit(fromVertex, toVertex);
+		}
+		return true;
+	};
+	std::unordered_map<ll, ll> indexer; //gives vertices an index in order of appearance (the numbering of 'readFile')
+	std::vector<ll> bound; //number of edges of each vertex in the file, duplicates and self-loops included
+	labels.clear();
+	auto index = [&](const ll& x) {
+		auto inserted = indexer.emplace(x, labels.size());
+		if (inserted.second) { labels.push_back(x); bound.push_back(0); }
+		return inserted.first->second;
+	};
+	if (!scan([&](const ll& fromVertex, const ll& toVertex) { ll from = index(fromVertex); index(toVertex); bound[from]++; })) return false;
+	graph = buildCompressed(labels.size(), bound, budget, [&](auto emit) {
+		scan([&](const ll& fromVertex, const ll& toVertex) { emit(indexer[fromVertex], indexer[toVertex]); });
+	});
+	hash = mixHash(graph.n);
+	for (ll i = 0; i < graph.n; i++) {
+		for (CompressedIterator itr = graph.neighbours(i); itr.valid(); itr.next()) hash += mixHash(mixHash(labels[i]) ^ labels[itr.value()]);
+	}
+	return true;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- returns the subgraph of a compressed graph induced by a set of vertices, as a CompressedGraph
+- vertex members[i] of the graph is vertex i of the subgraph
+PARAMETERS:
+- graph: the compressed graph
+- members: the vertices of the subgraph
+- encoder: an array of graph.n entries filled with -1 (left filled with -1)
+- budget: the maximum number of uncompressed neighbours held at once
+*/
+CompressedGraph inducedSubgraph(CompressedGraph& graph, const std::vector<ll>& members, ll*& encoder, const ll& budget = 1LL << 24) {
+	ll vertices = members.size();
+	std::vector<ll> bound(vertices);
+	for (ll i = 0; i < vertices; i++) { encoder[members[i]] = i; bound[i] = graph.degree(members[i]); }
+	CompressedGraph subgraph = buildCompressed(vertices, bound, budget, [&](auto emit) {
+		for (ll v = 0; v < vertices; v++) {
+			for (CompressedIterator itr = graph.neighbours(members[v]); itr.valid(); itr.next()) {
+				if (encoder[itr.value()] != -1) emit(v, encoder[itr.value()]);
+			}
+		}
+	});
+	for (ll i = 0; i < vertices; i++) encoder[members[i]] = -1;
+	return subgraph;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- returns the reverse of a compressed directed graph (every edge (x,y) becomes (y,x)) without decompressing it as a whole
+- the graph is decoded twice (once to count the rows, once to collect them)
+PARAMETERS:
+- graph: the compressed directed graph
+- budget: the maximum number of uncompressed neighbours held at once
+*/
+CompressedGraph reverseCompressed(CompressedGraph& graph, const ll& budget = 1LL << 24) {
+	std::vector<ll> indegree(graph.n, 0);
+	for (ll i = 0; i < graph.n; i++) {
+		for (CompressedIterator itr = graph.neighbours(i); itr.valid(); itr.next()) indegree[itr.value()]++;
+	}
+	return buildCompressed(graph.n, indegree, budget, [&](auto emit) {
+		for (ll i = 0; i < graph.n; i++) {
+			for (CompressedIterator itr = graph.neighbours(i); itr.valid(); itr.next()) emit(itr.value(), i);
+		}
+	});
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- returns the underlying undirected graph of a compressed directed graph as a symmetric CompressedGraph
+- junk edges (duplicates and self-loops) will be discarded, the directed graph is left intact
+- the graph is decoded twice (once to count the rows, once to collect them)
+PARAMETERS:
+- graph: the compressed directed graph
+- budget: the maximum number of uncompressed neighbours held at once
+*/
+CompressedGraph makeUndirected(CompressedGraph& graph, const ll& budget = 1LL << 24) {
+	std::vector<ll> bound(graph.n, 0);
+	for (ll i = 0; i < graph.n; i++) {
+		for (CompressedIterator itr = graph.neighbours(i); itr.valid(); itr.next()) { bound[i]++; bound[itr.value()]++; }
+	}
+	return buildCompressed(graph.n, bound, budget, [&](auto emit) {
+		for (ll i = 0; i < graph.n; i++) {
+			for (CompressedIterator itr = graph.neighbours(i); itr.valid(); itr.next()) { emit(i, itr.value()); emit(itr.value(), i); }
+		}
+	});
+}
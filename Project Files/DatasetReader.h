@@ -5,7 +5,7 @@ Written By:
 2- Modar Abdullah (Lines 30-50) ('extract' function)
 3- Yazan Al-Jendi (Lines 51-80) ('makeUnique' function)
 4- Batoul Khaleel (Lines 81-95) ('tune' function)
-5- Edward Assaf (Lines 96-108) ('readFile' function)
+5- Edward Assaf (Lines 96-108) ('readFile', 'mixHash' functions)
 */
 
 #pragma once
@@ -14,6 +14,7 @@ Written By:
 #include <string>
 #include <map>
 #include <set>
+#include <vector>
 #include "LinkedList.h"
 
 /*
@@ -72,7 +73,7 @@ void makeUnique(LinkedList<ll>& list) {
 		clone.push_front(itr.value());
 	}
 	itr = clone.get_clone();
-	list = LinkedList<ll>();
+	while (list.get_len()) list.pop_front();
 	while (clone.get_len()) {
 		list.push_front(clone.pop_front());
 	}
@@ -93,6 +94,20 @@ void tune(LinkedList<ll>*& adjList, const ll& vertices) {
 	}
 }
 
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- scrambles the bits of an integer ('splitmix64' finalizer), used to build order-independent graph hashes
+PARAMETERS:
+- x: the integer
+*/
+unsigned long long mixHash(unsigned long long x) {
+	x += 0x9E3779B97F4A7C15ULL;
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+	return x ^ (x >> 31);
+}
+
 /*
 WRITTEN BY EDWARD ASSAF
 JOB:
@@ -104,8 +119,10 @@ PARAMETERS:
 - file_path: the path of the .txt dataset
 - adjList: a null or uninitialized pointer to 'LinkedList<ll>' which will be initialized with the adjacency list
 - size: a null or uninitialized integer that will be storing the number of vertices in the graph
+- labels: a vector that will store the dataset's id of each vertex (labels[i] = x -> vertex i is vertex x in the file)
+- hash: an integer that will store a canonical hash of the graph (see below)
 */
-bool readFile(const std::string& file_path, LinkedList<ll>*& adjList, ll& size) {
+bool readFile(const std::string& file_path, LinkedList<ll>*& adjList, ll& size, std::vector<ll>& labels, unsigned long long& hash) {
 	std::fstream datasetReader;
 	std::map<ll, ll>indexer; //gives vertices an index (useful for unordered vertices)
 	ll index = 1; //index used to number vertices (starts from 1 to allow 0 to be the default 'unindexed' state)
@@ -132,5 +149,32 @@ bool readFile(const std::string& file_path, LinkedList<ll>*& adjList, ll& size)
 		adjList[edge.first].push_front(edge.second);
 	}
 	tune(adjList, size);
+	//the hash depends only on the set of tuned edges (by dataset ids), not on their order or duplicates in the file
+	labels.assign(size, 0);
+	for (auto& i : indexer) labels[i.second - 1] = i.first;
+	hash = mixHash(size);
+	for (ll i = 0; i < size; i++) {
+		ListIterator<ll> itr(adjList[i].get_clone());
+		for (ll j = 0; j < adjList[i].get_len(); j++) {
+			hash += mixHash(mixHash(labels[i]) ^ labels[itr.value()]);
+			itr.next();
+		}
+	}
 	return true;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- reads a SNAP .txt dataset file and extracts the graph and the number of vertices from it
+- same as the previous 'readFile' without keeping the dataset's ids and the hash
+PARAMETERS:
+- file_path: the path of the .txt dataset
+- adjList: a null or uninitialized pointer to 'LinkedList<ll>' which will be initialized with the adjacency list
+- size: a null or uninitialized integer that will be storing the number of vertices in the graph
+*/
+bool readFile(const std::string& file_path, LinkedList<ll>*& adjList, ll& size) {
+	std::vector<ll> labels;
+	unsigned long long hash;
+	return readFile(file_path, adjList, size, labels, hash);
 }
\ No newline at end of file
@@ -0,0 +1,126 @@
+/*
+File 12: Generators.h
+Written By:
+1- Edward Assaf (all of it)
+*/
+
+#pragma once
+#include <vector>
+#include <random>
+#include <numeric>
+#include <algorithm>
+#include "LinkedList.h"
+#include "CSRGraph.h"
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- generates a directed 'R-MAT' (recursive matrix, Kronecker-like) graph with 2^scale vertices and skewed degrees
+- every edge picks one quadrant of the adjacency matrix per level with probabilities a, b, c and 1-a-b-c
+- junk edges are discarded, so the result may have slightly less edges than requested
+PARAMETERS:
+- scale: the base-2 logarithm of the number of vertices
+- edges: the number of edges to generate
+- seed: the seed of the random generator (equal seeds give equal graphs)
+- a, b, c: the quadrant probabilities (the defaults are the usual 'Graph500' parameters)
+*/
+CSRGraph rmatGraph(const ll& scale, const ll& edges, const unsigned long long& seed,
+	const double& a = 0.57, const double& b = 0.19, const double& c = 0.19) {
+	std::mt19937_64 rng(seed);
+	std::uniform_real_distribution<double> coin(0, 1);
+	std::vector<std::pair<ll, ll>> list(edges);
+	for (auto& e : list) {
+		ll from = 0, to = 0;
+		for (ll level = 0; level < scale; level++) {
+			double r = coin(rng);
+			from <<= 1; to <<= 1;
+			if (r < a) continue;
+			if (r < a + b) to |= 1;
+			else if (r < a + b + c) from |= 1;
+			else { from |= 1; to |= 1; }
+		}
+		e = { from, to };
+	}
+	return toCSR(1LL << scale, list);
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- generates a directed 'Erdos-Renyi' graph G(n,m) where every edge joins two uniformly random vertices
+- junk edges are discarded, so the result may have slightly less edges than requested
+PARAMETERS:
+- vertices: the number of vertices
+- edges: the number of edges to generate
+- seed: the seed of the random generator (equal seeds give equal graphs)
+*/
+CSRGraph erdosRenyiGraph(const ll& vertices, const ll& edges, const unsigned long long& seed) {
+	std::mt19937_64 rng(seed);
+	std::uniform_int_distribution<ll> pick(0, vertices - 1);
+	std::vector<std::pair<ll, ll>> list(edges);
+	for (auto& e : list) { e.first = pick(rng); e.second = pick(rng); }
+	return toCSR(vertices, list);
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- generates a graph that is guaranteed to be 2-vertex strongly biconnected (for at least three vertices)
+- the base is the circulant graph where every vertex i is joined in both directions to i+1 and i+2 (mod n), whose underlying
+  graph stays biconnected after deleting any vertex, then extra random edges are added (adding edges keeps the property)
+- vertices are shuffled so the base cycle does not follow the vertex numbering
+PARAMETERS:
+- vertices: the number of vertices (at least 3)
+- extra: the number of extra random edges
+- seed: the seed of the random generator (equal seeds give equal graphs)
+*/
+CSRGraph twoVertexStronglyBiconnectedGraph(const ll& vertices, const ll& extra, const unsigned long long& seed) {
+	std::mt19937_64 rng(seed);
+	std::vector<ll> label(vertices);
+	std::iota(label.begin(), label.end(), 0);
+	std::shuffle(label.begin(), label.end(), rng);
+	std::vector<std::pair<ll, ll>> list;
+	for (ll i = 0; i < vertices; i++) {
+		for (ll step = 1; step <= 2; step++) {
+			ll j = (i + step) % vertices;
+			list.push_back({ label[i], label[j] });
+			list.push_back({ label[j], label[i] });
+		}
+	}
+	std::uniform_int_distribution<ll> pick(0, vertices - 1);
+	for (ll i = 0; i < extra; i++) list.push_back({ pick(rng), pick(rng) });
+	return toCSR(vertices, list);
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- generates a long cycle joined in both directions (adversarial for depth-first-search depth)
+- the graph is strongly biconnected but NOT 2-vertex strongly biconnected (deleting any vertex leaves a path)
+PARAMETERS:
+- vertices: the number of vertices
+*/
+CSRGraph longCycleGraph(const ll& vertices) {
+	std::vector<std::pair<ll, ll>> list;
+	for (ll i = 0; i < vertices; i++) {
+		list.push_back({ i, (i + 1) % vertices });
+		list.push_back({ (i + 1) % vertices, i });
+	}
+	return toCSR(vertices, list);
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- generates a directed path 0 -> 1 -> ... -> n-1 where every vertex also has an edge back to vertex 0
+- the graph is strongly connected with a depth-first-search tree of depth n, and every inner vertex of the path is a
+  strong articulation point (adversarial for depth-first-search depth and dominators)
+PARAMETERS:
+- vertices: the number of vertices
+*/
+CSRGraph deepPathGraph(const ll& vertices) {
+	std::vector<std::pair<ll, ll>> list;
+	for (ll i = 0; i + 1 < vertices; i++) list.push_back({ i, i + 1 });
+	for (ll i = 1; i < vertices; i++) list.push_back({ i, 0 });
+	return toCSR(vertices, list);
+}
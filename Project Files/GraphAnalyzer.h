@@ -0,0 +1,121 @@
+/*
+File 15: GraphAnalyzer.h
+Written By:
+1- Edward Assaf (all of it)
+*/
+
+#pragma once
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "LinkedList.h"
+#include "DatasetReader.h"
+#include "CSRGraph.h"
+#include "CSRFunctions.h"
+
+//the questions a GraphAnalyzer answers about G-S for a set of deleted vertices S
+enum class Query { StronglyConnected, StronglyBiconnected, TwoVertexStronglyBiconnected };
+
+//a session that loads a graph once and answers any number of queries about deleting vertex sets from it
+//the graph, its underlying graph and every scratch array are allocated once and reused by all queries
+//warning: a session is not safe to share between threads, use one session per thread
+class GraphAnalyzer {
+private:
+	CSRGraph graph; //the directed graph
+	CSRGraph reversed; //the reverse of the graph
+	CSRGraph undirected; //the underlying undirected graph
+	std::vector<ll> labels; //the dataset's id of each vertex
+	std::unordered_map<ll, ll> index; //the vertex of each dataset id
+	bool* removed; //the deleted vertices of the current query
+	Workspace<CSRGraph>* workspace; //scratch state shared by all traversals
+
+	//builds the reverse graph, the underlying graph and the scratch state once the graph is known
+	void prepare(const ll& threads) {
+		reversed.clear();
+		reversed = reverseCSR(graph, threads);
+		undirected.clear();
+		undirected = makeUndirected(graph, reversed, threads);
+		removed = new bool[graph.n + 1]{};
+		workspace = new Workspace<CSRGraph>(graph.n);
+		for (ll i = 0; i < ll(labels.size()); i++) index[labels[i]] = i;
+	}
+	//marks the vertices of S as deleted (value = true) or restores them (value = false), unknown vertices are skipped
+	void mark(const std::vector<ll>& S, const bool& value) {
+		for (auto& v : S) if (v >= 0 && v < graph.n) removed[v] = value;
+	}
+	//returns the number of vertices that are not deleted
+	ll remaining() {
+		ll count = 0;
+		for (ll i = 0; i < graph.n; i++) count += !removed[i];
+		return count;
+	}
+	//answers a query about the graph without the currently deleted vertices
+	bool answer(const Query& query) {
+		bool strongly_connected = ::isStronglyConnected(graph, reversed, removed, *workspace);
+		if (query == Query::StronglyConnected || !strongly_connected) return strongly_connected;
+		bool biconnected = ::isBiconnected(undirected, removed, *workspace);
+		if (query == Query::StronglyBiconnected || !biconnected) return biconnected;
+		if (remaining() < 3) return false;
+		for (ll w = 0; w < graph.n; w++) { //G-S is 2-vertex strongly biconnected if G-S-{w} is strongly biconnected for all w
+			if (removed[w]) continue;
+			removed[w] = true;
+			bool passed = ::isStronglyConnected(graph, reversed, removed, *workspace) && ::isBiconnected(undirected, removed, *workspace);
+			removed[w] = false;
+			if (!passed) return false;
+		}
+		return true;
+	}
+public:
+	//constructor, takes over a directed graph (vertex i is labeled i)
+	GraphAnalyzer(CSRGraph& g, const ll& threads = 1) : graph(g), reversed(), undirected(), removed(nullptr), workspace(nullptr) {
+		labels.resize(graph.n);
+		for (ll i = 0; i < graph.n; i++) labels[i] = i;
+		prepare(threads);
+	}
+	//constructor, loads a SNAP .txt dataset (see 'loaded'), vertices of queries are the dataset's ids
+	GraphAnalyzer(const std::string& file_path, const ll& threads = 1) : removed(nullptr), workspace(nullptr) {
+		LinkedList<ll>* adjList;
+		ll n = 0;
+		unsigned long long hash;
+		if (!readFile(file_path, adjList, n, labels, hash)) { n = 0; labels.clear(); adjList = new LinkedList<ll>[1]; }
+		graph.clear();
+		graph = toCSR(adjList, n);
+		releaseAdjList(adjList, n);
+		prepare(threads);
+	}
+	GraphAnalyzer(const GraphAnalyzer&) = delete;
+	GraphAnalyzer& operator=(const GraphAnalyzer&) = delete;
+	//destructor
+	~GraphAnalyzer() {
+		graph.clear(); reversed.clear(); undirected.clear();
+		delete[] removed; delete workspace;
+	}
+	//returns true if the session holds a graph
+	bool loaded() { return graph.n > 0; }
+	//returns the number of vertices of the graph
+	ll vertices() { return graph.n; }
+	//returns the vertex of a dataset id, or -1 if the id is not in the graph
+	ll vertex(const ll& label) {
+		auto itr = index.find(label);
+		return itr == index.end() ? -1 : itr->second;
+	}
+	//answers a query about G-S, where S is a set of vertices (not dataset ids)
+	bool ask(const Query& query, const std::vector<ll>& S) {
+		mark(S, true);
+		bool result = answer(query);
+		mark(S, false);
+		return result;
+	}
+	//returns true if G-S is strongly connected
+	bool isStronglyConnected(const std::vector<ll>& S = {}) { return ask(Query::StronglyConnected, S); }
+	//returns true if G-S is strongly biconnected
+	bool isStronglyBiconnected(const std::vector<ll>& S = {}) { return ask(Query::StronglyBiconnected, S); }
+	//returns true if G-S is 2-vertex strongly biconnected
+	bool isTwoVertexStronglyBiconnected(const std::vector<ll>& S = {}) { return ask(Query::TwoVertexStronglyBiconnected, S); }
+	//answers a batch of queries in order, results[i] is the answer of queries[i] about G-sets[i]
+	std::vector<bool> batch(const std::vector<Query>& queries, const std::vector<std::vector<ll>>& sets) {
+		std::vector<bool> results(queries.size());
+		for (size_t i = 0; i < queries.size(); i++) results[i] = ask(queries[i], sets[i]);
+		return results;
+	}
+};
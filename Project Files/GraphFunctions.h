@@ -133,6 +133,7 @@ ll* gabow(LinkedList<ll>*& adjList, const ll& vertices) {
 		if (visited[i]) continue;
 		gabow_dfs(adjList, i, vertices, visited, inOstack, dfs_counter, dfs_numbers, ostack, rstack, components);
 	}
+	delete[] visited; delete[] inOstack; delete[] dfs_numbers;
 	return components;
 }
 
@@ -1,7 +1,7 @@
 /*
 File 2: LinkedList.h
 Written By:
-1- Edward Assaf (Lines 1-170) (all of it)
+1- Edward Assaf (Lines 1-174) (all of it)
 */
 
 #pragma once
@@ -82,10 +82,13 @@ public:
 		len++;
 	}
 	//drops and returns head of linked list 'involves c-assertion'
+	//the dropped node is freed, so lists sharing nodes with a copy must not be popped
 	T pop_front() {
 		assert(len > 0);
+		ListNode<T>* dropped = head;
 		T droppedHead = head->val;
 		head = head->next;
+		delete dropped;
 		len--;
 		return droppedHead;
 	}
@@ -97,6 +100,7 @@ public:
 		ListNode<T>* clone = head;
 		for (ll i = 0; i < len - 2; i++) clone = clone->next;
 		droppedHead = clone->next->val;
+		delete clone->next;
 		clone->next = nullptr;
 		len--;
 		return droppedHead;
@@ -162,7 +166,7 @@ public:
 			itr.next();
 		}
 		if (itr.value() != v) clone.push_front(itr.value());
-		head = nullptr; len = 0;
+		while (len) pop_front(); //frees the old nodes
 		while (clone.len) { //push elements back from clone to main to re-reverse order
 			push_front(clone.pop_front());
 		}
@@ -0,0 +1,249 @@
+/*
+File 16: Memory.h
+Written By:
+1- Edward Assaf (all of it)
+*/
+
+#pragma once
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <new>
+#include <atomic>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <map>
+#include <mutex>
+#include "LinkedList.h"
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <pthread.h>
+#include <sched.h>
+#endif
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#endif
+
+//build flags: -DNO_HUGE_PAGES keeps every array on the heap, -DNO_NUMA disables binding threads to NUMA nodes,
+//-DNO_PREFETCH disables software prefetching in the traversals (useful to measure each of them in 'main')
+
+//how a block of memory was obtained
+enum class Placement { Heap = 0, TransparentHugePages = 1, HugePages = 2 };
+
+const size_t HUGE_PAGE_SIZE = size_t(1) << 21; //2MB, the huge page size of x86-64 and most arm64 kernels
+const size_t BLOCK_HEADER = 64; //bytes in front of every heap block, heap blocks are 64-byte aligned so the arrays stay aligned to cache lines
+const ll PREFETCH_DISTANCE = 8; //how many vertices ahead the traversals prefetch
+
+std::atomic<ll> placedBytes[3]; //bytes currently held by each placement
+std::atomic<ll> peakBytes[3]; //the most bytes ever held by each placement at once
+std::atomic<bool> hugePagesAvailable(true); //false once the kernel refused explicit huge pages (none reserved)
+
+//the header stored in front of every heap block
+class BlockHeader {
+public:
+	size_t bytes; //the size of the whole block, header included
+	Placement placement; //how the block was obtained
+};
+
+std::mutex mappedLock; //guards 'mappedBlocks'
+//the size and placement of every mapped block by its address, kept apart so nothing is written into the block itself
+std::map<void*, std::pair<size_t, Placement>> mappedBlocks;
+
+//returns true if the kernel honours 'madvise(MADV_HUGEPAGE)' ('always' or 'madvise' mode of transparent huge pages)
+bool transparentHugePagesEnabled() {
+	static const bool enabled = [] {
+		std::ifstream reader("/sys/kernel/mm/transparent_hugepage/enabled");
+		std::string modes;
+		return std::getline(reader, modes) && modes.find("[never]") == std::string::npos;
+	}();
+	return enabled;
+}
+
+//records that a block of 'bytes' bytes was obtained (positive) or released (negative) with a placement
+void account(const Placement& placement, const ll& bytes) {
+	ll now = (placedBytes[int(placement)] += bytes);
+	ll peak = peakBytes[int(placement)].load();
+	while (now > peak && !peakBytes[int(placement)].compare_exchange_weak(peak, now));
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- allocates a block of memory, backed by huge pages when it spans at least one huge page, to save TLB misses
+- tries explicit huge pages (reserved through vm.nr_hugepages) first, then transparent huge pages on a 2MB aligned
+  mapping, then falls back to the heap, so it never fails because huge pages are missing
+- mapped blocks are NOT touched here (they are recorded in 'mappedBlocks' instead of carrying a header): their pages are
+  placed on the NUMA node of the thread that writes them first, heap blocks start with a 'BlockHeader'
+- returns a pointer to the block (throws std::bad_alloc if there is no memory at all)
+PARAMETERS:
+- bytes: the size of the block
+- placement: set to how the block was obtained
+*/
+void* allocateBlock(const size_t& bytes, Placement& placement) {
+	size_t total = bytes + BLOCK_HEADER;
+	char* base = nullptr;
+	placement = Placement::Heap;
+#if defined(__linux__) && !defined(NO_HUGE_PAGES)
+	if (bytes >= HUGE_PAGE_SIZE) {
+		size_t mapped = (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+		if (hugePagesAvailable.load(std::memory_order_relaxed)) {
+			void* block = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+			if (block != MAP_FAILED) { base = (char*)block; placement = Placement::HugePages; }
+			else hugePagesAvailable.store(false, std::memory_order_relaxed); //stop asking for every block
+		}
+		if (!base && transparentHugePagesEnabled()) { //maps one extra huge page and trims the ends to align the block
+			void* block = mmap(nullptr, mapped + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (block != MAP_FAILED) {
+				char* start = (char*)block, *end = start + mapped + HUGE_PAGE_SIZE;
+				char* aligned = (char*)(((uintptr_t)start + HUGE_PAGE_SIZE - 1) & ~uintptr_t(HUGE_PAGE_SIZE - 1));
+				if (aligned > start) munmap(start, aligned - start);
+				if (end > aligned + mapped) munmap(aligned + mapped, end - (aligned + mapped));
+				if (madvise(aligned, mapped, MADV_HUGEPAGE) == 0) { base = aligned; placement = Placement::TransparentHugePages; }
+				else munmap(aligned, mapped);
+			}
+		}
+		if (base) {
+			std::lock_guard<std::mutex> guard(mappedLock);
+			mappedBlocks[base] = { mapped, placement };
+			account(placement, mapped);
+			return base;
+		}
+	}
+#endif
+	total = (total + BLOCK_HEADER - 1) / BLOCK_HEADER * BLOCK_HEADER; //aligned_alloc wants a multiple of the alignment
+	base = (char*)std::aligned_alloc(BLOCK_HEADER, total);
+	if (!base) throw std::bad_alloc();
+	BlockHeader* header = (BlockHeader*)base;
+	header->bytes = total; header->placement = placement;
+	account(placement, total);
+	return base + BLOCK_HEADER;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- releases a block obtained from 'allocateBlock' (nullptr is ignored)
+PARAMETERS:
+- block: the block
+*/
+void releaseBlock(void* block) {
+	if (!block) return;
+#if defined(__linux__)
+	{
+		std::unique_lock<std::mutex> guard(mappedLock);
+		auto itr = mappedBlocks.find(block);
+		if (itr != mappedBlocks.end()) {
+			std::pair<size_t, Placement> mapped = itr->second;
+			mappedBlocks.erase(itr);
+			guard.unlock();
+			account(mapped.second, -ll(mapped.first));
+			munmap(block, mapped.first);
+			return;
+		}
+	}
+#endif
+	char* base = (char*)block - BLOCK_HEADER;
+	BlockHeader* header = (BlockHeader*)base;
+	account(header->placement, -ll(header->bytes));
+	std::free(base);
+}
+
+//allocates an array of 'count' elements of a trivial type T through 'allocateBlock'
+//zeroed = true fills the array with zeros (mapped blocks already are, so their pages stay untouched)
+template<typename T>
+T* allocateArray(const ll& count, const bool& zeroed = false) {
+	size_t bytes = sizeof(T) * size_t(count > 0 ? count : 1);
+	Placement placement;
+	T* array = (T*)allocateBlock(bytes, placement);
+	if (zeroed && placement == Placement::Heap) std::memset((void*)array, 0, bytes);
+	return array;
+}
+
+//releases an array obtained from 'allocateArray' and resets the pointer
+template<typename T>
+void releaseArray(T*& array) {
+	releaseBlock((void*)array);
+	array = nullptr;
+}
+
+//hints the processor to load the cache line of an address that will be read soon
+inline void prefetch(const void* address) {
+#if defined(NO_PREFETCH)
+	(void)address;
+#elif defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(address);
+#elif defined(_MSC_VER)
+	_mm_prefetch((const char*)address, _MM_HINT_T0);
+#else
+	(void)address;
+#endif
+}
+
+//parses a Linux CPU or node list such as "0-3,8-11" into its numbers
+std::vector<int> parseList(const std::string& list) {
+	std::vector<int> numbers;
+	std::stringstream reader(list);
+	std::string range;
+	while (std::getline(reader, range, ',')) {
+		if (range.find_first_of("0123456789") == std::string::npos) continue;
+		size_t dash = range.find('-');
+		int first = std::stoi(range.substr(0, dash));
+		int last = (dash == std::string::npos) ? first : std::stoi(range.substr(dash + 1));
+		for (int i = first; i <= last; i++) numbers.push_back(i);
+	}
+	return numbers;
+}
+
+//returns the CPUs of each NUMA node that has any (empty on single-node machines and unsupported platforms)
+std::vector<std::vector<int>> numaNodes() {
+	std::vector<std::vector<int>> nodes;
+#if defined(__linux__) && !defined(NO_NUMA)
+	std::ifstream online("/sys/devices/system/node/online");
+	std::string list;
+	if (!std::getline(online, list)) return nodes;
+	for (int node : parseList(list)) {
+		std::ifstream reader("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+		std::string cpus;
+		if (std::getline(reader, cpus) && !parseList(cpus).empty()) nodes.push_back(parseList(cpus)); //skips memory-only nodes
+	}
+#endif
+	if (nodes.size() < 2) nodes.clear();
+	return nodes;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- binds the calling thread (and the threads it creates afterwards) to the CPUs of one NUMA node, so the thread stays next
+  to the memory it touches first (graphs and scratch arrays are first written by the thread that analyzes them)
+- returns true if the thread was bound, and false on single-node machines and unsupported platforms (nothing changes)
+PARAMETERS:
+- index: the node is index modulo the number of nodes, so consecutive indices spread threads over the nodes
+*/
+bool bindToNode(const ll& index) {
+	static const std::vector<std::vector<int>> nodes = numaNodes();
+	if (nodes.empty()) return false;
+#if defined(__linux__) && !defined(NO_NUMA)
+	cpu_set_t cpus;
+	CPU_ZERO(&cpus);
+	for (int cpu : nodes[index % nodes.size()]) if (cpu < CPU_SETSIZE) CPU_SET(cpu, &cpus);
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+	(void)index;
+	return false;
+#endif
+}
+
+//returns a one line summary of the peak memory held by each placement and the number of NUMA nodes in use
+std::string memoryReport() {
+	const char* names[3] = { "on the heap", "in transparent huge pages", "in huge pages" };
+	std::ostringstream report;
+	report << std::fixed << std::setprecision(1) << "Peak memory:";
+	for (int i = 2; i >= 0; i--) report << ' ' << double(peakBytes[i].load()) / (1 << 20) << "MB " << names[i] << (i > 0 ? "," : "");
+	size_t nodes = numaNodes().size();
+	report << " (" << (nodes > 1 ? std::to_string(nodes) + " NUMA nodes" : std::string("single NUMA node")) << ")\n";
+	return report.str();
+}
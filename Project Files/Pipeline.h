@@ -0,0 +1,167 @@
+/*
+File 9: Pipeline.h
+Written By:
+1- Edward Assaf (all of it)
+*/
+
+#pragma once
+#include <iostream>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <condition_variable>
+#include "LinkedList.h"
+#include "DatasetReader.h"
+#include "CompressedGraph.h"
+#include "Memory.h"
+
+std::mutex consoleLock; //serializes everything the pipeline prints (reports and progress lines)
+
+//a stream buffer that prints every complete line written to it straight to std::cout under 'consoleLock', prefixed by the
+//name of a dataset, so progress of a long analysis shows up while it runs instead of with the final report
+//lines are printed when the stream is flushed (and when the buffer is destroyed)
+class ProgressBuffer : public std::stringbuf {
+private:
+	std::string prefix; //printed in front of every line
+public:
+	//constructor
+	ProgressBuffer(const std::string& name) : prefix("[" + name + "] ") {}
+	//prints the complete lines written so far and keeps the rest
+	int sync() override {
+		std::string text = str();
+		size_t end = text.rfind('\n');
+		if (end == std::string::npos) return 0;
+		{
+			std::lock_guard<std::mutex> guard(consoleLock);
+			std::istringstream lines(text.substr(0, end + 1));
+			std::string line;
+			while (std::getline(lines, line)) std::cout << prefix << line << '\n';
+			std::cout << std::flush;
+		}
+		str("");
+		sputn(text.data() + end + 1, text.size() - end - 1);
+		return 0;
+	}
+	//destructor
+	~ProgressBuffer() { sync(); }
+};
+
+//a first-in-first-out queue of limited capacity shared between threads
+//'push' blocks while the queue is full and 'pop' blocks while it is empty and not closed
+template<typename T>
+class BoundedQueue {
+private:
+	std::queue<T> items; //queued elements
+	size_t capacity; //maximum number of queued elements
+	bool closed; //true once no more elements will be pushed
+	std::mutex lock;
+	std::condition_variable notFull, notEmpty;
+public:
+	//constructor
+	BoundedQueue(const size_t& c = 1) : capacity(c > 0 ? c : 1), closed(false) {}
+	//adds an element v to the tail of the queue, waiting for space if needed
+	void push(const T& v) {
+		std::unique_lock<std::mutex> guard(lock);
+		notFull.wait(guard, [this] { return items.size() < capacity; });
+		items.push(v);
+		notEmpty.notify_one();
+	}
+	//stores the head of the queue in v and drops it, waiting for an element if needed
+	//returns false if the queue is closed and empty
+	bool pop(T& v) {
+		std::unique_lock<std::mutex> guard(lock);
+		notEmpty.wait(guard, [this] { return !items.empty() || closed; });
+		if (items.empty()) return false;
+		v = items.front(); items.pop();
+		notFull.notify_one();
+		return true;
+	}
+	//marks the end of the input, waiting 'pop' calls return false once the queue drains
+	void close() {
+		std::lock_guard<std::mutex> guard(lock);
+		closed = true;
+		notEmpty.notify_all();
+	}
+};
+
+//represents a dataset handed from the loader stage to the compute stage
+class LoadedGraph {
+public:
+	std::string name; //name of the dataset file
+	bool loaded; //false if the file could not be read
+	LinkedList<ll>* adjList; //the graph represented by an adjacency list (released by 'analyze', see 'releaseAdjList')
+	ll n; //the number of vertices in the graph
+	std::vector<ll> labels; //the dataset's id of each vertex
+	unsigned long long hash; //the canonical hash of the graph
+	ll threads; //the number of threads the compute stage may use on this graph
+	CompressedGraph compressed; //the graph read by 'readCompressed' instead of the adjacency list (cleared by 'analyze')
+};
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- processes a list of datasets with a loader stage that reads the next graphs while a compute stage analyzes the current ones
+- loaded graphs wait in a bounded queue, so at most 'capacity' parsed graphs are held in memory ahead of the compute stage
+- the thread budget is split between the stages, and each dataset's report is printed as soon as it completes
+- compute threads left over when there are fewer datasets than workers are handed to each graph ('LoadedGraph::threads')
+- on NUMA machines the compute threads are spread over the nodes, so each graph is built and swept on one node
+PARAMETERS:
+- directory: the directory of the datasets
+- datasets: the names of the dataset files
+- threads: the total number of threads of both stages (at least 2 is needed to overlap loading with computing, 1 loads and
+  analyzes every dataset in turn on the calling thread)
+- capacity: the maximum number of loaded graphs waiting for the compute stage
+- analyze: a function that returns the report of a loaded graph and releases its adjacency list (it must be safe to run
+  concurrently, progress written to a stream on a 'ProgressBuffer' is printed while it runs)
+- compressed: true loads every dataset straight into 'LoadedGraph::compressed' (no adjacency list is built)
+*/
+void runPipeline(const std::string& directory, const std::vector<std::string>& datasets, const ll& threads, const ll& capacity,
+	const std::function<std::string(LoadedGraph&)>& analyze, const bool& compressed = false) {
+	ll loaders = 1, workers = 1;
+	if (threads > 2) { loaders = std::max(1LL, threads / 4); workers = threads - loaders; } //parsing is cheaper than computing
+	ll per_graph = 1;
+	if (workers > ll(datasets.size()) && !datasets.empty()) { per_graph = workers / datasets.size(); workers = datasets.size(); }
+	auto load = [&](const ll& k) {
+		LoadedGraph graph{ datasets[k], false, nullptr, 0, {}, 0, per_graph, CompressedGraph() };
+		if (compressed) {
+			graph.loaded = readCompressed(directory + datasets[k], graph.compressed, graph.labels, graph.hash);
+			graph.n = graph.compressed.n;
+		}
+		else graph.loaded = readFile(directory + datasets[k], graph.adjList, graph.n, graph.labels, graph.hash);
+		return graph;
+	};
+	auto finish = [&](LoadedGraph& graph) {
+		std::string report = graph.loaded ? analyze(graph) : "Failed to read file: Incorrect path.\n";
+		std::lock_guard<std::mutex> guard(consoleLock);
+		std::cout << "Dataset " << graph.name << ":\n" << report << '\n' << std::flush;
+	};
+	if (threads <= 1) {
+		for (ll k = 0; k < ll(datasets.size()); k++) {
+			LoadedGraph graph = load(k);
+			finish(graph);
+		}
+		return;
+	}
+	BoundedQueue<LoadedGraph> queue(capacity);
+	std::atomic<ll> next(0), active_loaders(loaders);
+	std::vector<std::thread> pool;
+	for (ll i = 0; i < loaders; i++) {
+		pool.emplace_back([&] {
+			for (ll k = next++; k < ll(datasets.size()); k = next++) queue.push(load(k));
+			if (--active_loaders == 0) queue.close();
+		});
+	}
+	for (ll i = 0; i < workers; i++) {
+		pool.emplace_back([&, i] {
+			bindToNode(i);
+			LoadedGraph graph;
+			while (queue.pop(graph)) finish(graph);
+		});
+	}
+	for (auto& t : pool) t.join();
+}
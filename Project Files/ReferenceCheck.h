@@ -0,0 +1,422 @@
+/*
+File 13: ReferenceCheck.h
+Written By:
+1- Edward Assaf (all of it)
+*/
+
+#pragma once
+#include <iostream>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <vector>
+#include <map>
+#include <bitset>
+#include <algorithm>
+#include <random>
+#include "LinkedList.h"
+#include "DatasetReader.h"
+#include "GraphFunctions.h"
+#include "CSRGraph.h"
+#include "CSRFunctions.h"
+#include "CompressedGraph.h"
+#include "TwoVertexComponents.h"
+#include "Sweep.h"
+#include "GraphAnalyzer.h"
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- reference test of the biconnectivity of an undirected graph straight from the definition, using only 'dfs' and 'removeVertex'
+- returns true if the graph is connected and stays connected after deleting any single vertex, and false otherwise
+PARAMETERS:
+- adjList: the undirected graph represented by an adjacency list
+- vertices: the number of vertices in the graph
+*/
+bool referenceBiconnected(LinkedList<ll>*& adjList, const ll& vertices) {
+	if (vertices == 0) return true;
+	bool* visited = new bool[vertices] {};
+	LinkedList<ll> tree = dfs(adjList, 0, visited);
+	bool connected = (tree.get_len() == vertices);
+	releaseList(tree);
+	delete[] visited;
+	if (!connected) return false;
+	if (vertices <= 2) return true;
+	for (ll i = 0; i < vertices; i++) {
+		LinkedList<ll>* test = adjList;
+		ll remaining = vertices;
+		removeVertex(test, remaining, i); //'test' becomes a new copy without vertex i
+		visited = new bool[remaining] {};
+		tree = dfs(test, 0, visited);
+		connected = (tree.get_len() == remaining);
+		releaseList(tree);
+		delete[] visited;
+		releaseAdjList(test, remaining);
+		if (!connected) return false;
+	}
+	return true;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- reference test of the strong biconnectivity of a directed graph using 'gabow', 'makeUndirected' and 'referenceBiconnected'
+- returns true if the graph is strongly connected and its underlying graph is biconnected, and false otherwise
+PARAMETERS:
+- adjList: the directed graph represented by an adjacency list (left intact)
+- vertices: the number of vertices in the graph
+*/
+bool referenceStronglyBiconnected(LinkedList<ll>*& adjList, const ll& vertices) {
+	if (vertices == 0) return true;
+	ll* components = gabow(adjList, vertices);
+	bool strongly_connected = isStronglyConnected(components, vertices);
+	delete[] components;
+	if (!strongly_connected) return false;
+	CSRGraph copy = toCSR(adjList, vertices);
+	LinkedList<ll>* undirected = toAdjList(copy);
+	copy.clear();
+	makeUndirected(undirected, vertices);
+	bool biconnected = referenceBiconnected(undirected, vertices);
+	releaseAdjList(undirected, vertices);
+	return biconnected;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- reference test of the 2-vertex strong biconnectivity of a directed graph straight from the definition
+- returns true if the graph has at least three vertices and G-{w} is strongly biconnected for all vertices w, and false otherwise
+PARAMETERS:
+- adjList: the directed graph represented by an adjacency list (left intact)
+- vertices: the number of vertices in the graph
+*/
+bool referenceTwoVertex(LinkedList<ll>*& adjList, const ll& vertices) {
+	if (vertices < 3 || !referenceStronglyBiconnected(adjList, vertices)) return false;
+	for (ll i = 0; i < vertices; i++) {
+		LinkedList<ll>* test = adjList;
+		ll remaining = vertices;
+		removeVertex(test, remaining, i); //'test' becomes a new copy without vertex i
+		bool passed = referenceStronglyBiconnected(test, remaining);
+		releaseAdjList(test, remaining);
+		if (!passed) return false;
+	}
+	return true;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- checks the checkpoints of 'sweep': a saved checkpoint loads back unchanged, a matching checkpoint is resumed (and
+  removed) with the same result as a sweep from scratch, and checkpoints of another graph hash or another numbering of
+  the vertices are ignored even when they claim that every vertex passed
+- returns the number of mismatches
+PARAMETERS:
+- graph: a strongly biconnected directed graph (CSRGraph or CompressedGraph) with at least three vertices
+- reversed: the reverse of the graph
+- undirected: the underlying undirected graph
+- expected: the result of a sweep of the graph without checkpoints
+- name: the name of the graph in the report
+- out: the stream to write mismatches to
+*/
+template<typename Graph>
+ll checkpointCheck(Graph& graph, Graph& reversed, Graph& undirected, const ll& expected, const std::string& name, std::ostream& out) {
+	const std::string path = "differential.checkpoint";
+	const unsigned long long hash = mixHash(graph.n), numbering = mixHash(graph.m);
+	ll mismatches = 0;
+	auto report = [&](const std::string& what, const bool& passed) {
+		if (passed) return;
+		mismatches++;
+		out << "MISMATCH " << name << ": " << what << '\n';
+	};
+	SweepCheckpoint saved, loaded;
+	saved.hash = hash; saved.numbering = numbering; saved.n = graph.n;
+	saved.verified.assign(graph.n, false);
+	for (ll w = 0; w < (expected == -1 ? graph.n : expected); w += 2) saved.verified[w] = true; //vertices before the failing one pass
+	bool same = saved.save(path) && loaded.load(path) && loaded.hash == saved.hash && loaded.numbering == saved.numbering &&
+		loaded.n == saved.n && loaded.failing == saved.failing && loaded.verified == saved.verified;
+	report("checkpoint save and load", same);
+	std::ostringstream progress;
+	report("resumed sweep", sweep(graph, reversed, undirected, hash, numbering, path, 0, progress) == expected &&
+		progress.str().find("Resuming") != std::string::npos);
+	report("checkpoint removed after the sweep", !std::ifstream(path).is_open());
+	SweepCheckpoint foreign = saved;
+	foreign.verified.assign(graph.n, true);
+	foreign.numbering = numbering + 1;
+	foreign.save(path);
+	progress.str("");
+	report("checkpoint of another numbering ignored", sweep(graph, reversed, undirected, hash, numbering, path, 0, progress) == expected &&
+		progress.str().find("Resuming") == std::string::npos);
+	foreign.numbering = numbering; foreign.hash = hash + 1;
+	foreign.save(path);
+	progress.str("");
+	report("checkpoint of another graph ignored", sweep(graph, reversed, undirected, hash, numbering, path, 0, progress) == expected &&
+		progress.str().find("Resuming") == std::string::npos);
+	std::remove(path.c_str());
+	return mismatches;
+}
+
+//returns true if two compressed graphs are encoded identically
+bool sameCompressed(CompressedGraph& a, CompressedGraph& b) {
+	if (a.n != b.n || a.m != b.m || a.length != b.length) return false;
+	return a.n == 0 || (std::equal(a.anchors, a.anchors + a.n / ANCHOR_INTERVAL + 1, b.anchors) && std::equal(a.bytes, a.bytes + a.length, b.bytes));
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- writes a graph as a SNAP .txt dataset (with junk edges and dataset ids unlike its vertex numbers) and checks that
+  'readCompressed' reads the same graph, dataset ids and hash as 'readFile'
+- returns the number of mismatches
+PARAMETERS:
+- graph: the directed graph
+- name: the name of the graph in the report
+- out: the stream to write mismatches to
+*/
+ll readerCheck(CSRGraph& graph, const std::string& name, std::ostream& out) {
+	const std::string path = "differential.txt";
+	{
+		std::ofstream writer(path);
+		writer << "# Directed graph\n# " << name << "\n# Nodes: " << graph.n << " Edges: " << graph.m << "\n# FromNodeId\tToNodeId\n";
+		for (ll i = graph.n - 1; i >= 0; i--) {
+			for (CSRIterator itr = graph.neighbours(i); itr.valid(); itr.next()) writer << 7 * (graph.n - i) << '\t' << 7 * (graph.n - itr.value()) << '\n';
+			if (graph.degree(i) > 0) writer << 7 * (graph.n - i) << '\t' << 7 * (graph.n - graph.targets[graph.offsets[i]]) << '\n'; //duplicate
+			if (i % 3 == 0) writer << 7 * (graph.n - i) << '\t' << 7 * (graph.n - i) << '\n'; //self-loop
+		}
+	}
+	LinkedList<ll>* adjList = nullptr;
+	ll size = 0;
+	std::vector<ll> labels, compressed_labels;
+	unsigned long long hash = 0, compressed_hash = 0;
+	CompressedGraph compressed;
+	bool read = readFile(path, adjList, size, labels, hash) && readCompressed(path, compressed, compressed_labels, compressed_hash, 5);
+	std::remove(path.c_str());
+	CSRGraph expected = toCSR(adjList, size);
+	CompressedGraph expected_compressed = compress(expected);
+	bool same = read && sameCompressed(compressed, expected_compressed) && labels == compressed_labels && hash == compressed_hash;
+	releaseAdjList(adjList, size);
+	expected.clear(); expected_compressed.clear(); compressed.clear();
+	if (same) return 0;
+	out << "MISMATCH " << name << ": compressed dataset reader\n";
+	return 1;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- checks the answers of a GraphAnalyzer session about G-S (every query kind) against the reference tests on the subgraph
+  induced by the vertices outside S, for the empty set and a few random deletion sets S
+- returns the number of mismatches
+PARAMETERS:
+- graph: the directed graph (left intact, the session gets a copy)
+- name: the name of the graph in the report
+- out: the stream to write mismatches to
+*/
+ll analyzerCheck(CSRGraph& graph, const std::string& name, std::ostream& out) {
+	ll n = graph.n, mismatches = 0;
+	if (n == 0) return 0;
+	const std::string kinds[3] = { "sc", "sb", "2vsb" };
+	std::vector<ll> all(n);
+	for (ll i = 0; i < n; i++) all[i] = i;
+	ll* encoder = new ll[n];
+	std::fill(encoder, encoder + n, -1);
+	CSRGraph copy = inducedSubgraph(graph, all, encoder);
+	GraphAnalyzer analyzer(copy);
+	std::mt19937_64 rng(mixHash(n) ^ graph.m);
+	for (ll k = 0; k < 4; k++) {
+		ll size = (k == 0) ? 0 : rng() % std::min(n, 4LL); //at least one vertex is left
+		std::vector<bool> deleted(n, false);
+		std::vector<ll> S, rest;
+		while (ll(S.size()) < size) {
+			ll v = rng() % n;
+			if (!deleted[v]) { deleted[v] = true; S.push_back(v); }
+		}
+		for (ll i = 0; i < n; i++) if (!deleted[i]) rest.push_back(i);
+		CSRGraph induced = inducedSubgraph(graph, rest, encoder);
+		ll remaining = induced.n;
+		LinkedList<ll>* adjList = toAdjList(induced);
+		ll* components = gabow(adjList, remaining);
+		bool expected[3] = { isStronglyConnected(components, remaining), false, false };
+		delete[] components;
+		//each query implies the previous one, so the costly reference tests only run while the answers are still true
+		expected[1] = expected[0] && referenceStronglyBiconnected(adjList, remaining);
+		expected[2] = expected[1] && referenceTwoVertex(adjList, remaining);
+		releaseAdjList(adjList, remaining);
+		induced.clear();
+		for (int q = 0; q < 3; q++) {
+			bool answer = analyzer.ask(Query(q), S);
+			if (answer == expected[q]) continue;
+			mismatches++;
+			out << "MISMATCH " << name << ": GraphAnalyzer '" << kinds[q];
+			for (auto& v : S) out << ' ' << v;
+			out << "' (session: " << answer << ", reference: " << expected[q] << ")\n";
+		}
+	}
+	delete[] encoder;
+	return mismatches;
+}
+
+const ll BRUTE_FORCE_LIMIT = 10; //graphs of at most this many vertices get their components checked by 'referenceComponents'
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- reference computation of the maximal 2-vertex strongly biconnected components of a small directed graph straight from the
+  definition, by enumerating vertex subsets from the largest to the smallest
+- a subset is a component if no component found before contains it and its induced subgraph passes 'referenceTwoVertex'
+  (every superset of a subset is tried before it, so the components found are exactly the maximal ones)
+- returns the components as vectors of vertices in ascending order, sorted in ascending order
+PARAMETERS:
+- graph: the directed graph (at most 'BRUTE_FORCE_LIMIT' vertices, the enumeration runs O(2^n) reference tests)
+*/
+std::vector<std::vector<ll>> referenceComponents(CSRGraph& graph) {
+	ll n = graph.n;
+	std::vector<std::vector<ll>> components;
+	std::vector<unsigned long> masks, found;
+	for (unsigned long mask = 0; mask < (1UL << n); mask++) if (std::bitset<32>(mask).count() >= 3) masks.push_back(mask);
+	std::stable_sort(masks.begin(), masks.end(), [](const unsigned long& a, const unsigned long& b) {
+		return std::bitset<32>(a).count() > std::bitset<32>(b).count();
+	});
+	ll* encoder = new ll[n];
+	std::fill(encoder, encoder + n, -1);
+	for (auto& mask : masks) {
+		bool contained = false;
+		for (auto& component : found) contained = contained || ((mask & component) == mask);
+		if (contained) continue;
+		std::vector<ll> members;
+		for (ll i = 0; i < n; i++) if (mask >> i & 1) members.push_back(i);
+		CSRGraph subgraph = inducedSubgraph(graph, members, encoder);
+		LinkedList<ll>* adjList = toAdjList(subgraph);
+		if (referenceTwoVertex(adjList, subgraph.n)) { found.push_back(mask); components.push_back(members); }
+		releaseAdjList(adjList, subgraph.n);
+		subgraph.clear();
+	}
+	delete[] encoder;
+	std::sort(components.begin(), components.end());
+	return components;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- runs the CSR engines and the LinkedList implementation on the same graph and reports every verdict they disagree on
+- checked: strongly connected components, strong connectivity (by 'gabow' and by reachability, also after deleting each
+  single vertex), underlying graph, biconnectivity, 2-vertex strong
+  biconnectivity, and that every computed 2-vertex strongly biconnected component really is one
+- sweep checkpoints are checked by 'checkpointCheck' on every strongly biconnected graph
+- on graphs of at most 'BRUTE_FORCE_LIMIT' vertices the computed components must be exactly the maximal ones found by
+  'referenceComponents'
+- the CompressedGraph views (directed, reversed, undirected and induced subgraphs) are checked against the CSRGraph ones
+  as well, and 'readCompressed' against 'readFile' by 'readerCheck'
+- GraphAnalyzer sessions are checked on random deletion sets by 'analyzerCheck'
+- the LinkedList 'isBiconnected' is compared too, but its disagreements are counted apart in 'legacy_mismatches' because
+  the reference for biconnectivity is 'referenceBiconnected'
+- returns the number of mismatches
+PARAMETERS:
+- graph: the directed graph (small, the reference tests take O(n^2(n+m)) time)
+- name: the name of the graph in the report
+- legacy_mismatches: a counter that will be increased when the LinkedList 'isBiconnected' disagrees with the reference
+- out: the stream to write mismatches to
+*/
+ll differentialCheck(CSRGraph& graph, const std::string& name, ll& legacy_mismatches, std::ostream& out) {
+	ll mismatches = 0;
+	ll n = graph.n;
+	auto report = [&](const std::string& what, const bool& fast, const bool& reference) {
+		if (fast == reference) return;
+		mismatches++;
+		out << "MISMATCH " << name << ": " << what << " (CSR: " << fast << ", reference: " << reference << ")\n";
+	};
+	LinkedList<ll>* adjList = toAdjList(graph);
+	ll* reference_components = gabow(adjList, n);
+	ll* components = gabow(graph);
+	std::map<ll, ll> match; //representative in 'gabow' (LinkedList) -> representative in 'gabow' (CSR)
+	bool same_partition = true;
+	for (ll i = 0; i < n; i++) {
+		auto itr = match.find(reference_components[i]);
+		if (itr == match.end()) match[reference_components[i]] = components[i];
+		else same_partition = same_partition && (itr->second == components[i]);
+	}
+	std::map<ll, ll> inverse;
+	for (auto& i : match) inverse[i.second]++;
+	same_partition = same_partition && (inverse.size() == match.size());
+	report("strongly connected components", same_partition, true);
+	bool strongly_connected = isStronglyConnected(graph);
+	report("strong connectivity", strongly_connected, isStronglyConnected(reference_components, n));
+	CSRGraph reversed = reverseCSR(graph);
+	report("strong connectivity by reachability", isStronglyConnected(graph, reversed), strongly_connected);
+	bool* removed = new bool[n + 1]{};
+	for (ll w = 0; w < n; w++) { //every single deletion, the test the sweep relies on
+		removed[w] = true;
+		if (isStronglyConnected(graph, reversed, removed) != isStronglyConnected(graph, removed)) {
+			report("strong connectivity by reachability without vertex " + std::to_string(w), false, true);
+		}
+		removed[w] = false;
+	}
+	delete[] removed;
+	delete[] components;
+	CSRGraph undirected = makeUndirected(graph);
+	LinkedList<ll>* reference_undirected = toAdjList(graph);
+	makeUndirected(reference_undirected, n);
+	CSRGraph reference_csr = toCSR(reference_undirected, n);
+	bool same_undirected = (reference_csr.m == undirected.m) &&
+		std::equal(undirected.offsets, undirected.offsets + n + 1, reference_csr.offsets) &&
+		std::equal(undirected.targets, undirected.targets + undirected.m, reference_csr.targets);
+	reference_csr.clear();
+	report("underlying graph", same_undirected, true);
+	bool biconnected = isBiconnected(undirected);
+	bool reference_biconnected = referenceBiconnected(reference_undirected, n);
+	report("biconnectivity", biconnected, reference_biconnected);
+	if (n > 0 && isBiconnected(reference_undirected, n) != reference_biconnected) legacy_mismatches++;
+	bool candidate = (n >= 3 && strongly_connected && biconnected);
+	ll failing = candidate ? sweep(graph, reversed, undirected, 0, 0, "", 0, out) : -1;
+	bool two_vertex = candidate && failing == -1;
+	report("2-vertex strong biconnectivity", two_vertex, referenceTwoVertex(adjList, n));
+	if (candidate) mismatches += checkpointCheck(graph, reversed, undirected, failing, name, out);
+	std::vector<TwoVSBComponent> found = twoVertexComponents(graph);
+	for (auto& component : found) {
+		LinkedList<ll>* subgraph = toAdjList(component.subgraph);
+		report("component of size " + std::to_string(component.subgraph.n), true, referenceTwoVertex(subgraph, component.subgraph.n));
+		releaseAdjList(subgraph, component.subgraph.n);
+		component.subgraph.clear();
+	}
+	if (n <= BRUTE_FORCE_LIMIT) {
+		std::vector<std::vector<ll>> computed;
+		for (auto& component : found) computed.push_back(component.members);
+		std::sort(computed.begin(), computed.end());
+		report("maximal components (" + std::to_string(found.size()) + " computed)", computed == referenceComponents(graph), true);
+	}
+	if (two_vertex) report("components of a 2-vertex strongly biconnected graph", found.size() == 1 && ll(found[0].members.size()) == n, true);
+	CompressedGraph compressed = compress(graph);
+	CompressedGraph compressed_reversed = reverseCompressed(compressed, 7); //tiny budgets force several row ranges
+	CompressedGraph compressed_undirected = makeUndirected(compressed, 7);
+	CompressedGraph expected_reversed = compress(reversed), expected_undirected = compress(undirected);
+	report("compressed reverse graph", sameCompressed(compressed_reversed, expected_reversed), true);
+	report("compressed underlying graph", sameCompressed(compressed_undirected, expected_undirected), true);
+	std::vector<ll> members; //every other vertex
+	for (ll i = 0; i < n; i += 2) members.push_back(i);
+	ll* encoder = new ll[n + 1];
+	std::fill(encoder, encoder + n + 1, -1);
+	CSRGraph induced = inducedSubgraph(graph, members, encoder);
+	CompressedGraph compressed_induced = inducedSubgraph(compressed, members, encoder, 7), expected_induced = compress(induced);
+	report("compressed induced subgraph", sameCompressed(compressed_induced, expected_induced), true);
+	delete[] encoder;
+	induced.clear(); compressed_induced.clear(); expected_induced.clear();
+	mismatches += readerCheck(graph, name, out);
+	mismatches += analyzerCheck(graph, name, out);
+	components = gabow(graph);
+	ll* compressed_components = gabow(compressed);
+	report("compressed strongly connected components", std::equal(components, components + n, compressed_components), true);
+	report("compressed strong connectivity", isStronglyConnected(compressed), strongly_connected);
+	report("compressed strong connectivity by reachability", isStronglyConnected(compressed, compressed_reversed), strongly_connected);
+	report("compressed biconnectivity", isBiconnected(compressed_undirected), biconnected);
+	if (strongly_connected && biconnected) {
+		report("compressed 2-vertex strong biconnectivity", n >= 3 && sweep(compressed, compressed_reversed, compressed_undirected, 0, 0, "", 0, out) == -1,
+			two_vertex);
+	}
+	delete[] components; delete[] compressed_components; delete[] reference_components;
+	releaseAdjList(adjList, n); releaseAdjList(reference_undirected, n);
+	reversed.clear(); expected_reversed.clear(); expected_undirected.clear();
+	compressed.clear(); compressed_reversed.clear(); compressed_undirected.clear();
+	undirected.clear();
+	return mismatches;
+}
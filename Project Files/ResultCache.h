@@ -0,0 +1,130 @@
+/*
+File 10: ResultCache.h
+Written By:
+1- Edward Assaf (all of it)
+*/
+
+#pragma once
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include "LinkedList.h"
+
+//version of the results, records written with another version are ignored (bump it whenever a change can alter a result)
+//1: first version of the store
+//2, 3: bumped without any change of the engines, their records are the same as the ones of version 1
+//4: the largest SCC is picked from the components of the CSR 'gabow' (equally large SCCs may be picked differently)
+//5: graphs whose largest SCC has fewer than three vertices are NOT 2-vertex strongly biconnected (they were reported as such)
+const ll RESULT_VERSION = 5;
+
+//stores the outcome of testing one graph, vertices are identified by their ids in the dataset file
+class CachedResult {
+public:
+	ll version = RESULT_VERSION; //version of the code that computed the result
+	ll n = 0; //number of vertices
+	ll m = 0; //number of edges
+	ll sccs = 0; //number of strongly connected components
+	std::vector<std::pair<ll, ll>> sccSizes; //pairs <size, number of components of that size> in ascending order of size
+	std::vector<ll> largestSCC; //vertices of the largest strongly connected component in ascending order
+	bool biconnected = false; //true if the underlying graph of the largest strongly connected component is biconnected
+	bool verdict = false; //true if the graph is 2-vertex strongly biconnected
+	ll failing = -1; //a vertex w whose deletion broke the test (-1 if there is none)
+	std::vector<ll> componentSizes; //sizes of the 2-vertex strongly biconnected components in descending order
+};
+
+//a persistent store of test results keyed by the canonical graph hash computed by 'readFile'
+//the store is a plain text file with one record per line: '<hash> version=<version> key=value key=value ...'
+class ResultCache {
+private:
+	std::string path; //path of the store file
+	std::map<unsigned long long, CachedResult> records; //records loaded from and appended to the file
+	std::mutex lock; //the cache is shared by the compute threads of the pipeline
+
+	//writes a list as comma-separated values ('-' for an empty list)
+	static void writeList(std::ostream& out, const std::vector<ll>& list) {
+		if (list.empty()) { out << '-'; return; }
+		for (size_t i = 0; i < list.size(); i++) out << (i ? "," : "") << list[i];
+	}
+	//reads a list written by 'writeList'
+	static std::vector<ll> readList(const std::string& text) {
+		std::vector<ll> list;
+		if (text == "-") return list;
+		std::stringstream in(text);
+		std::string item;
+		while (std::getline(in, item, ',')) list.push_back(std::stoll(item));
+		return list;
+	}
+	//returns a record as a line of the store file
+	static std::string encode(const unsigned long long& hash, const CachedResult& result) {
+		std::ostringstream out;
+		out << std::hex << hash << std::dec << " version=" << result.version << " n=" << result.n << " m=" << result.m << " sccs=" << result.sccs << " scc_sizes=";
+		std::vector<ll> sizes;
+		for (auto& i : result.sccSizes) { sizes.push_back(i.first); sizes.push_back(i.second); }
+		writeList(out, sizes);
+		out << " biconnected=" << result.biconnected << " verdict=" << result.verdict << " failing=" << result.failing;
+		out << " components=";
+		writeList(out, result.componentSizes);
+		out << " largest_scc=";
+		writeList(out, result.largestSCC);
+		return out.str();
+	}
+	//parses a line of the store file, returns false if the line is malformed (records without a version get version 0)
+	static bool decode(const std::string& line, unsigned long long& hash, CachedResult& result) {
+		result.version = 0;
+		std::istringstream in(line);
+		if (!(in >> std::hex >> hash >> std::dec)) return false;
+		std::string field;
+		try {
+			while (in >> field) {
+				size_t split = field.find('=');
+				if (split == std::string::npos) return false;
+				std::string key = field.substr(0, split), value = field.substr(split + 1);
+				if (key == "version") result.version = std::stoll(value);
+				else if (key == "n") result.n = std::stoll(value);
+				else if (key == "m") result.m = std::stoll(value);
+				else if (key == "sccs") result.sccs = std::stoll(value);
+				else if (key == "biconnected") result.biconnected = (value == "1");
+				else if (key == "verdict") result.verdict = (value == "1");
+				else if (key == "failing") result.failing = std::stoll(value);
+				else if (key == "components") result.componentSizes = readList(value);
+				else if (key == "largest_scc") result.largestSCC = readList(value);
+				else if (key == "scc_sizes") {
+					std::vector<ll> sizes = readList(value);
+					for (size_t i = 0; i + 1 < sizes.size(); i += 2) result.sccSizes.push_back({ sizes[i], sizes[i + 1] });
+				}
+			}
+		}
+		catch (...) { return false; }
+		return true;
+	}
+public:
+	//constructor, loads the records of the store file (a missing file is an empty store)
+	//records of other versions than 'RESULT_VERSION' are skipped, so results of older code are recomputed
+	ResultCache(const std::string& file_path) : path(file_path) {
+		std::ifstream reader(path);
+		std::string line;
+		while (std::getline(reader, line)) {
+			unsigned long long hash;
+			CachedResult result;
+			if (decode(line, hash, result) && result.version == RESULT_VERSION) records[hash] = result; //later records overwrite earlier ones
+		}
+	}
+	//stores the record of a hash in result, returns false if there is no such record
+	bool find(const unsigned long long& hash, CachedResult& result) {
+		std::lock_guard<std::mutex> guard(lock);
+		auto itr = records.find(hash);
+		if (itr == records.end()) return false;
+		result = itr->second;
+		return true;
+	}
+	//adds a record and appends it to the store file
+	void store(const unsigned long long& hash, const CachedResult& result) {
+		std::lock_guard<std::mutex> guard(lock);
+		records[hash] = result;
+		std::ofstream writer(path, std::ios::app);
+		writer << encode(hash, result) << '\n';
+	}
+};
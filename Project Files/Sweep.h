@@ -0,0 +1,144 @@
+/*
+File 11: Sweep.h
+Written By:
+1- Edward Assaf (all of it)
+*/
+
+#pragma once
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include "LinkedList.h"
+#include "DatasetReader.h"
+#include "CSRGraph.h"
+#include "CSRFunctions.h"
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- returns an order-dependent hash of the dataset ids of the vertices of a graph (vertex i has id labels[i])
+- the same edge set listed in another order gets other vertex numbers and so another hash, unlike the graph hash
+PARAMETERS:
+- labels: the dataset ids of the vertices in order
+*/
+unsigned long long numberingHash(const std::vector<ll>& labels) {
+	unsigned long long hash = mixHash(labels.size());
+	for (auto& label : labels) hash = mixHash(hash ^ (unsigned long long)label);
+	return hash;
+}
+
+//the state of a per-vertex sweep that can be saved to a file and resumed from it
+class SweepCheckpoint {
+public:
+	unsigned long long hash = 0; //hash of the dataset the swept graph comes from
+	unsigned long long numbering = 0; //hash of the numbering of the swept vertices (see 'numberingHash')
+	ll n = 0; //number of vertices of the swept graph
+	std::vector<bool> verified; //verified[w] = true -> deleting vertex w was already tested and passed
+	ll failing = -1; //a vertex whose deletion failed the test (-1 if there is none so far)
+
+	//writes the checkpoint to a temporary file and renames it over 'path', so a crash never leaves a partial checkpoint
+	//returns true if the checkpoint is written successfully and false otherwise
+	bool save(const std::string& path) {
+		std::string temporary = path + ".tmp";
+		std::ofstream writer(temporary, std::ios::binary | std::ios::trunc);
+		if (!writer.is_open()) return false;
+		const unsigned long long magic = 0x32565342434B5032ULL; //"2VSBCKP2"
+		writer.write((const char*)&magic, sizeof(magic));
+		writer.write((const char*)&hash, sizeof(hash));
+		writer.write((const char*)&numbering, sizeof(numbering));
+		writer.write((const char*)&n, sizeof(n));
+		writer.write((const char*)&failing, sizeof(failing));
+		std::vector<unsigned char> bits((n + 7) / 8, 0); //one bit per vertex
+		for (ll i = 0; i < n; i++) if (verified[i]) bits[i / 8] |= (unsigned char)(1 << (i % 8));
+		writer.write((const char*)bits.data(), bits.size());
+		writer.close();
+		if (!writer) return false;
+		return std::rename(temporary.c_str(), path.c_str()) == 0;
+	}
+	//reads a checkpoint written by 'save', returns false if the file is missing or damaged
+	bool load(const std::string& path) {
+		std::ifstream reader(path, std::ios::binary);
+		if (!reader.is_open()) return false;
+		unsigned long long magic = 0;
+		reader.read((char*)&magic, sizeof(magic));
+		reader.read((char*)&hash, sizeof(hash));
+		reader.read((char*)&numbering, sizeof(numbering));
+		reader.read((char*)&n, sizeof(n));
+		reader.read((char*)&failing, sizeof(failing));
+		if (!reader || magic != 0x32565342434B5032ULL || n < 0) return false;
+		std::vector<unsigned char> bits((n + 7) / 8, 0);
+		reader.read((char*)bits.data(), bits.size());
+		if (!reader) return false;
+		verified.assign(n, false);
+		for (ll i = 0; i < n; i++) verified[i] = (bits[i / 8] >> (i % 8)) & 1;
+		return true;
+	}
+};
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- tests the 2-vertex strong biconnectivity of a STRONGLY BICONNECTED graph by deleting one vertex w at a time and
+  testing the strong connectivity of G-w (by forward and backward reachability) and the biconnectivity of its underlying graph
+- the state is saved to a checkpoint file every 'interval' seconds, and a matching checkpoint found at start is resumed,
+  skipping the vertices it already verified (a checkpoint matches if it has the same graph hash, the same numbering of
+  the vertices and the same number of vertices, so bits are never applied to other vertices)
+- the checkpoint file is deleted once the sweep ends
+- the graph must have at least three vertices: smaller graphs are never 2-vertex strongly biconnected, every G-w of them
+  passes trivially, so callers reject them before sweeping ('analyze' reports them as NOT 2-vertex strongly biconnected)
+- returns a vertex whose deletion fails the test, or -1 if the graph is 2-vertex strongly biconnected
+PARAMETERS:
+- graph: the directed graph (CSRGraph or CompressedGraph)
+- reversed: the reverse of the graph of the same type (see 'reverseCSR' and 'reverseCompressed')
+- undirected: the underlying undirected graph of the same type (see 'makeUndirected')
+- hash: the hash of the dataset the graph comes from (used to reject checkpoints of other graphs)
+- numbering: the hash of the dataset ids of the vertices in order (used to reject checkpoints of other numberings)
+- path: the path of the checkpoint file (an empty path disables checkpoints)
+- interval: the number of seconds between checkpoints
+- out: the stream to write progress to (flushed after every line)
+*/
+template<typename Graph>
+ll sweep(Graph& graph, Graph& reversed, Graph& undirected, const unsigned long long& hash, const unsigned long long& numbering,
+	const std::string& path, const double& interval, std::ostream& out) {
+	using namespace std::chrono;
+	SweepCheckpoint checkpoint;
+	ll done = 0;
+	if (!path.empty() && checkpoint.load(path) && checkpoint.hash == hash && checkpoint.numbering == numbering && checkpoint.n == graph.n) {
+		for (ll i = 0; i < graph.n; i++) done += checkpoint.verified[i];
+		out << "-> Resuming from checkpoint (" << done << " of " << graph.n << " vertices verified)\n" << std::flush;
+	}
+	else {
+		checkpoint = SweepCheckpoint();
+		checkpoint.hash = hash; checkpoint.numbering = numbering; checkpoint.n = graph.n;
+		checkpoint.verified.assign(graph.n, false);
+	}
+	bool* removed = new bool[graph.n] {};
+	Workspace<Graph> workspace(graph.n); //shared by every test of the sweep
+	auto last_save = steady_clock::now();
+	for (ll w = 0; w < graph.n && checkpoint.failing == -1; w++) {
+		if (checkpoint.verified[w]) continue;
+		removed[w] = true;
+		if (!isStronglyConnected(graph, reversed, removed, workspace) || !isBiconnected(undirected, removed, workspace)) {
+			checkpoint.failing = w;
+		}
+		else {
+			checkpoint.verified[w] = true; done++;
+			if (done % 1000 == 0) {
+				out << std::fixed << std::setprecision(1) << (double(done) * 100) / graph.n << "% Complete\n";
+				out << std::defaultfloat << std::setprecision(6) << std::flush;
+			}
+		}
+		removed[w] = false;
+		if (!path.empty() && duration<double>(steady_clock::now() - last_save).count() >= interval) {
+			checkpoint.save(path);
+			last_save = steady_clock::now();
+		}
+	}
+	delete[] removed;
+	if (!path.empty()) std::remove(path.c_str());
+	return checkpoint.failing;
+}
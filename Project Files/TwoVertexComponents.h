@@ -0,0 +1,174 @@
+/*
+File 8: TwoVertexComponents.h
+Written By:
+1- Edward Assaf (all of it)
+*/
+
+#pragma once
+#include <iostream>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include "LinkedList.h"
+#include "CSRGraph.h"
+#include "CSRFunctions.h"
+
+//represents a maximal 2-vertex strongly biconnected subgraph of some graph
+class TwoVSBComponent {
+public:
+	std::vector<ll> members; //vertices of the original graph in ascending order (members[i] is vertex i of subgraph)
+	CSRGraph subgraph; //the induced subgraph
+};
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- splits a candidate subgraph into smaller candidates that together contain all of its 2-vertex strongly biconnected subgraphs
+- tries, in order: peeling vertices with less than two in-neighbours or out-neighbours, strongly connected components,
+  blocks of the underlying graph, strongly connected components after deleting a strong articulation point, and blocks
+  of the underlying graph after deleting a vertex
+- returns the smaller candidates in local vertex numbering, an empty result means the candidate is 2-vertex strongly biconnected
+PARAMETERS:
+- graph: the candidate subgraph (at least three vertices)
+- reversed: the reverse of the candidate subgraph
+- undirected: the underlying undirected graph of the candidate subgraph
+*/
+std::vector<std::vector<ll>> splitCandidate(CSRGraph& graph, CSRGraph& reversed, CSRGraph& undirected) {
+	//every vertex of a 2-vertex strongly biconnected subgraph has at least two in-neighbours and two out-neighbours in it
+	std::vector<ll> outdegree(graph.n), indegree(graph.n), peeled;
+	std::vector<bool> dropped(graph.n, false);
+	for (ll i = 0; i < graph.n; i++) {
+		outdegree[i] = graph.degree(i); indegree[i] = reversed.degree(i);
+		if (outdegree[i] < 2 || indegree[i] < 2) { dropped[i] = true; peeled.push_back(i); }
+	}
+	for (size_t k = 0; k < peeled.size(); k++) {
+		for (CSRIterator itr = reversed.neighbours(peeled[k]); itr.valid(); itr.next()) {
+			ll v = itr.value();
+			if (!dropped[v] && --outdegree[v] < 2) { dropped[v] = true; peeled.push_back(v); }
+		}
+		for (CSRIterator itr = graph.neighbours(peeled[k]); itr.valid(); itr.next()) {
+			ll v = itr.value();
+			if (!dropped[v] && --indegree[v] < 2) { dropped[v] = true; peeled.push_back(v); }
+		}
+	}
+	if (!peeled.empty()) {
+		std::vector<std::vector<ll>> pieces(1);
+		for (ll i = 0; i < graph.n; i++) if (!dropped[i]) pieces[0].push_back(i);
+		return pieces;
+	}
+	ll* components = gabow(graph);
+	std::vector<std::vector<ll>> pieces = groupComponents(components, graph.n);
+	delete[] components;
+	if (pieces.size() > 1) return pieces;
+	pieces = biconnectedBlocks(undirected);
+	if (pieces.size() > 1) return pieces;
+	//graph is strongly biconnected, a failing vertex w splits it into pieces that are each extended by w
+	bool* removed = new bool[graph.n] {};
+	std::vector<ll> points = strongArticulationPoints(graph, reversed);
+	pieces.clear();
+	if (!points.empty()) {
+		removed[points[0]] = true;
+		components = gabow(graph, removed);
+		pieces = groupComponents(components, graph.n);
+		delete[] components;
+		for (auto& piece : pieces) piece.push_back(points[0]);
+	}
+	else {
+		Workspace<CSRGraph> workspace(graph.n);
+		for (ll w = 0; w < graph.n; w++) {
+			removed[w] = true;
+			if (!isBiconnected(undirected, removed, workspace)) {
+				pieces = biconnectedBlocks(undirected, removed);
+				for (auto& piece : pieces) piece.push_back(w);
+				break;
+			}
+			removed[w] = false;
+		}
+	}
+	delete[] removed;
+	return pieces;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- computes the maximal 2-vertex strongly biconnected subgraphs (components) of a directed graph
+- candidates start as the strongly connected components and are refined by 'splitCandidate' until they are
+  2-vertex strongly biconnected or have less than three vertices
+- returns the components in descending order of size
+PARAMETERS:
+- graph: the directed graph
+*/
+std::vector<TwoVSBComponent> twoVertexComponents(CSRGraph& graph) {
+	std::vector<TwoVSBComponent> found;
+	ll* encoder = new ll[graph.n];
+	std::fill(encoder, encoder + graph.n, -1);
+	ll* components = gabow(graph);
+	std::vector<std::vector<ll>> candidates = groupComponents(components, graph.n);
+	delete[] components;
+	std::set<std::vector<ll>> seen; //candidates already refined (different splits may produce the same candidate)
+	while (!candidates.empty()) {
+		std::vector<ll> candidate = candidates.back(); candidates.pop_back();
+		if (candidate.size() < 3 || seen.count(candidate)) continue;
+		seen.insert(candidate);
+		CSRGraph subgraph = inducedSubgraph(graph, candidate, encoder);
+		CSRGraph reversed = reverseCSR(subgraph);
+		CSRGraph undirected = makeUndirected(subgraph);
+		std::vector<std::vector<ll>> pieces = splitCandidate(subgraph, reversed, undirected);
+		reversed.clear(); undirected.clear();
+		if (pieces.empty()) { found.push_back({ candidate, subgraph }); continue; }
+		subgraph.clear();
+		for (auto& piece : pieces) {
+			for (auto& v : piece) v = candidate[v];
+			std::sort(piece.begin(), piece.end());
+			if (piece.size() >= 3) candidates.push_back(piece);
+		}
+	}
+	delete[] encoder;
+	//a candidate may be 2-vertex strongly biconnected while a larger component contains it, such candidates are dropped
+	std::sort(found.begin(), found.end(), [](const TwoVSBComponent& a, const TwoVSBComponent& b) {
+		return a.members.size() > b.members.size();
+	});
+	std::vector<TwoVSBComponent> result;
+	for (auto& component : found) {
+		bool contained = false;
+		for (auto& larger : result) {
+			if (larger.members.size() > component.members.size() &&
+				std::includes(larger.members.begin(), larger.members.end(), component.members.begin(), component.members.end())) {
+				contained = true; break;
+			}
+		}
+		if (contained) component.subgraph.clear();
+		else result.push_back(component);
+	}
+	return result;
+}
+
+/*
+WRITTEN BY EDWARD ASSAF
+JOB:
+- outputs a report about 2-vertex strongly biconnected components
+- useful for 'twoVertexComponents' function
+PARAMETERS:
+- components: the components in descending order of size
+- vertices: the number of vertices in the original graph
+- out: the stream to write the report to
+*/
+void componentsReport(std::vector<TwoVSBComponent>& components, const ll& vertices, std::ostream& out = std::cout) {
+	out << "Number of 2-vertex strongly biconnected components: " << components.size() << '\n';
+	if (components.empty()) return;
+	std::vector<bool> covered(vertices, false);
+	ll covered_count = 0, total = 0;
+	for (auto& component : components) {
+		total += component.members.size();
+		for (auto& v : component.members) {
+			if (!covered[v]) { covered[v] = true; covered_count++; }
+		}
+	}
+	TwoVSBComponent& largest = components.front();
+	TwoVSBComponent& smallest = components.back();
+	out << "Largest component size: " << largest.subgraph.n << " vertices, " << largest.subgraph.m << " edges\n";
+	out << "Smallest component size: " << smallest.subgraph.n << " vertices, " << smallest.subgraph.m << " edges\n";
+	out << "Average component size: " << double(total) / components.size() << " vertices\n";
+	out << "Vertices covered by components: " << covered_count << " / " << vertices << '\n';
+}
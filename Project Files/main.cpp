@@ -5,63 +5,448 @@ Written By:
 2- Jawa Abd-Al-Hadi (Lines 37-49)
 3- Batoul Khaleel (Lines 50-58)
 4- Modar Abdullah (Lines 59-67)
+5- Edward Assaf (2-vertex strongly biconnected components report, pipelined batch runner, result cache, checkpointed sweep, synthetic benchmarks and differential check, compressed graphs, query sessions, memory placement)
 */
 
 #include <iostream>
 #include <iomanip>
 #include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <map>
+#include <algorithm>
+#include <random>
 #include "LinkedList.h"
 #include "DatasetReader.h"
 #include "CustomDatasets.h"
 #include "GraphFunctions.h"
+#include "CSRGraph.h"
+#include "TwoVertexComponents.h"
+#include "Pipeline.h"
+#include "ResultCache.h"
+#include "Sweep.h"
+#include "Generators.h"
+#include "CompressedGraph.h"
+#include "GraphAnalyzer.h"
+#include "Memory.h"
+#include "ReferenceCheck.h"
 using namespace std::chrono;
 
-int main() {
-	ll n;
-	LinkedList<ll>* adjList;
-	for (ll i = 0; i < SNAP::datasets.size(); i++) {
-		std::cout << "Reading file " << SNAP::datasets[i] << "...\n";
-		if (!readFile(SNAP::directory + SNAP::datasets[i], adjList, n)) {
-			std::cout << "Failed to read file: Incorrect path.\n";
-			continue;
+const double CHECKPOINT_INTERVAL = 60; //seconds between checkpoints of a per-vertex sweep
+
+//computes and outputs the maximal 2-vertex strongly biconnected components of a graph that failed the test
+//returns the sizes of the components in descending order
+std::vector<ll> decompose(CSRGraph& graph, std::ostream& out) {
+	out << "Computing 2-vertex strongly biconnected components...\n";
+	auto start = high_resolution_clock::now();
+	std::vector<TwoVSBComponent> components = twoVertexComponents(graph);
+	auto end = high_resolution_clock::now();
+	duration<double, std::milli> d = end - start;
+	componentsReport(components, graph.n, out);
+	out << "Components Time: " << d.count() << "ms\n";
+	std::vector<ll> sizes;
+	for (auto& component : components) { sizes.push_back(component.subgraph.n); component.subgraph.clear(); }
+	return sizes;
+}
+
+//outputs a result found in the cache
+void cachedReport(CachedResult& result, std::ostream& out) {
+	out << "Result (cached): Graph is " << (result.verdict ? "" : "NOT ") << "2-vertex strongly biconnected!\n";
+	out << "Number of strongly connected components: " << result.sccs << '\n';
+	out << "Largest strongly connected component size: " << result.largestSCC.size() << '\n';
+	out << "Underlying graph of largest strongly connected component is " << (result.biconnected ? "" : "NOT ") << "biconnected\n";
+	if (result.failing != -1) out << "Failing vertex: " << result.failing << '\n';
+	out << "Number of 2-vertex strongly biconnected components: " << result.componentSizes.size() << '\n';
+	if (!result.componentSizes.empty()) out << "Largest component size: " << result.componentSizes.front() << " vertices\n";
+}
+
+//stores the vertices of the largest strongly connected component (the first one of the largest size, same choice as
+//'extractLargestSCC') in members, and the number and sizes of the components and the dataset ids of the largest in result
+void largestComponent(ll* components, const ll& n, const std::vector<ll>& labels, std::vector<ll>& members, CachedResult& result) {
+	std::map<ll, ll> tracker; //tracks the number of vertices in each component
+	for (ll i = 0; i < n; i++) tracker[components[i]]++;
+	ll max = 0, largest_component = -1;
+	for (auto& i : tracker) if (i.second > max) { max = i.second; largest_component = i.first; }
+	for (ll i = 0; i < n; i++) if (components[i] == largest_component) members.push_back(i);
+	std::map<ll, ll> sizes;
+	for (auto& i : tracker) sizes[i.second]++;
+	result.sccs = tracker.size();
+	result.sccSizes.assign(sizes.begin(), sizes.end());
+	for (auto& i : members) result.largestSCC.push_back(labels[i]);
+	std::sort(result.largestSCC.begin(), result.largestSCC.end());
+}
+
+//tests the 2-vertex strong biconnectivity of a loaded dataset and returns the report
+//results are looked up in and added to the cache by the graph's hash
+std::string analyze(LoadedGraph& graph, ResultCache& cache) {
+	std::ostringstream out;
+	ll n = graph.n;
+	LinkedList<ll>* adjList = graph.adjList;
+	ll m = 0;
+	for (ll i = 0; i < n; i++) m += adjList[i].get_len();
+	CachedResult result;
+	if (cache.find(graph.hash, result) && result.n == n && result.m == m) { //answered before building anything
+		releaseAdjList(graph.adjList, graph.n);
+		cachedReport(result, out);
+		return out.str();
+	}
+	CSRGraph directed = toCSR(adjList, n); //kept intact for the components decomposition
+	releaseAdjList(graph.adjList, graph.n); //the CSR graphs are all that is needed from here on
+	result = CachedResult();
+	result.n = directed.n; result.m = directed.m;
+	std::vector<ll> members; //vertices of the tested graph (members[i] is vertex i after extracting the largest SCC)
+	out << "Testing Strong Connectivity of Directed Graph...\n";
+	auto start = high_resolution_clock::now();
+	ll* components = gabow(directed);
+	largestComponent(components, n, graph.labels, members, result);
+	CSRGraph tested = directed; //the largest SCC, the directed graph itself stays intact
+	if (!isStronglyConnected(components, n)) {
+		out << "-> Maximum SCC is being considered...\n";
+		ll* encoder = new ll[n];
+		std::fill(encoder, encoder + n, -1);
+		tested = inducedSubgraph(directed, members, encoder);
+		delete[] encoder;
+	}
+	n = tested.n;
+	auto end = high_resolution_clock::now();
+	delete[] components;
+	out << "Testing Two-Connectivity of Underlying Graph...\n";
+	auto start2 = high_resolution_clock::now();
+	CSRGraph reversed = reverseCSR(tested, graph.threads); //built once, reused by the sweep
+	CSRGraph undirected = makeUndirected(tested, reversed, graph.threads);
+	result.biconnected = isBiconnected(undirected);
+	if (!result.biconnected || n < 3) { //2-vertex strongly biconnected graphs have at least three vertices
+		auto end2 = high_resolution_clock::now();
+		duration<double, std::milli> d1 = end - start;
+		duration<double, std::milli> d2 = end2 - start2;
+		out << "Result: Graph is NOT 2-vertex strongly biconnected!" << (n < 3 ? " (fewer than three vertices)" : "") << "\n";
+		out << "Gabow Time: " << d1.count() << "ms\n";
+		out << "Jens Time: " << d2.count() << "ms\n";
+		result.componentSizes = decompose(directed, out);
+		if (tested.targets != directed.targets) tested.clear();
+		directed.clear(); reversed.clear(); undirected.clear();
+		cache.store(graph.hash, result);
+		return out.str();
+	}
+	auto end2 = high_resolution_clock::now();
+	out << "Bruteforcing... (2-vertex strong biconnectivity candidate)\n";
+	auto start3 = high_resolution_clock::now();
+	ProgressBuffer buffer(graph.name);
+	std::ostream progress(&buffer); //printed while the sweep runs, not with the report
+	std::vector<ll> numbering; //dataset ids of the swept vertices, ties the checkpoint to this numbering of the vertices
+	for (auto& i : members) numbering.push_back(graph.labels[i]);
+	ll failing = sweep(tested, reversed, undirected, graph.hash, numberingHash(numbering), graph.name + ".checkpoint",
+		CHECKPOINT_INTERVAL, progress);
+	auto end3 = high_resolution_clock::now();
+	reversed.clear();
+	bool success = (failing == -1);
+	if (!success) result.failing = graph.labels[members[failing]];
+	if (success) out << "100% Complete: Graph is 2-vertex strongly biconnected!\n";
+	else out << "100% Complete: Graph is NOT 2-vertex strongly biconnected! (Failing vertex: " << result.failing << ")\n";
+	result.verdict = success;
+	duration<double, std::milli> d1 = end - start;
+	duration<double, std::milli> d2 = end2 - start2;
+	duration<double, std::milli> d3 = end3 - start3;
+	out << "Gabow Time: " << d1.count() << "ms\n";
+	out << "Jens Time: " << d2.count() << "ms\n";
+	out << "Sweep Time: " << d3.count() << "ms\n";
+	if (!success) result.componentSizes = decompose(directed, out);
+	if (tested.targets != directed.targets) tested.clear();
+	directed.clear(); undirected.clear();
+	cache.store(graph.hash, result);
+	return out.str();
+}
+
+//tests the 2-vertex strong biconnectivity of a dataset loaded as a CompressedGraph ('main --compressed') and returns the report
+//every step runs on compressed graphs, so the components of a failing graph are not computed (they are CSRGraph subgraphs)
+//results are looked up in the cache by the graph's hash, and only verdicts that need no components are added to it
+std::string analyzeCompressed(LoadedGraph& graph, ResultCache& cache) {
+	std::ostringstream out;
+	CompressedGraph& directed = graph.compressed;
+	ll n = directed.n;
+	CachedResult result;
+	if (cache.find(graph.hash, result) && result.n == n && result.m == directed.m) {
+		directed.clear();
+		cachedReport(result, out);
+		return out.str();
+	}
+	result = CachedResult();
+	result.n = directed.n; result.m = directed.m;
+	std::vector<ll> members; //vertices of the tested graph (members[i] is vertex i after extracting the largest SCC)
+	out << "Testing Strong Connectivity of Directed Graph...\n";
+	auto start = high_resolution_clock::now();
+	ll* components = gabow(directed);
+	largestComponent(components, n, graph.labels, members, result);
+	CompressedGraph tested = directed;
+	if (!isStronglyConnected(components, n)) {
+		out << "-> Maximum SCC is being considered...\n";
+		ll* encoder = new ll[n];
+		std::fill(encoder, encoder + n, -1);
+		tested = inducedSubgraph(directed, members, encoder);
+		delete[] encoder;
+		directed.clear(); //only the largest SCC is needed from here on
+	}
+	auto end = high_resolution_clock::now();
+	delete[] components;
+	out << "Testing Two-Connectivity of Underlying Graph...\n";
+	auto start2 = high_resolution_clock::now();
+	CompressedGraph undirected = makeUndirected(tested);
+	result.biconnected = isBiconnected(undirected);
+	auto end2 = high_resolution_clock::now();
+	ll memory = tested.memory() + undirected.memory(), edges = tested.m + undirected.m;
+	duration<double, std::milli> d3(0);
+	bool candidate = (result.biconnected && tested.n >= 3); //2-vertex strongly biconnected graphs have at least three vertices
+	if (candidate) {
+		auto start3 = high_resolution_clock::now();
+		out << "Bruteforcing... (2-vertex strong biconnectivity candidate)\n";
+		CompressedGraph reversed = reverseCompressed(tested);
+		memory += reversed.memory(); edges += reversed.m;
+		ProgressBuffer buffer(graph.name);
+		std::ostream progress(&buffer); //printed while the sweep runs, not with the report
+		std::vector<ll> numbering; //dataset ids of the swept vertices, ties the checkpoint to this numbering of the vertices
+		for (auto& i : members) numbering.push_back(graph.labels[i]);
+		ll failing = sweep(tested, reversed, undirected, graph.hash, numberingHash(numbering), graph.name + ".checkpoint",
+			CHECKPOINT_INTERVAL, progress);
+		d3 = high_resolution_clock::now() - start3;
+		reversed.clear();
+		result.verdict = (failing == -1);
+		if (!result.verdict) result.failing = graph.labels[members[failing]];
+		if (result.verdict) out << "100% Complete: Graph is 2-vertex strongly biconnected!\n";
+		else out << "100% Complete: Graph is NOT 2-vertex strongly biconnected! (Failing vertex: " << result.failing << ")\n";
+	}
+	else out << "Result: Graph is NOT 2-vertex strongly biconnected!" << (tested.n < 3 ? " (fewer than three vertices)" : "") << "\n";
+	duration<double, std::milli> d1 = end - start;
+	duration<double, std::milli> d2 = end2 - start2;
+	out << "Gabow Time: " << d1.count() << "ms\n";
+	out << "Jens Time: " << d2.count() << "ms\n";
+	if (candidate) out << "Sweep Time: " << d3.count() << "ms\n";
+	out << "Compressed Memory: " << double(memory) / std::max(1LL, edges) << " bytes per stored edge (directed, underlying and reverse graphs)\n";
+	if (!result.verdict) out << "2-vertex strongly biconnected components are not computed on compressed graphs (run without --compressed)\n";
+	else cache.store(graph.hash, result);
+	if (tested.bytes != directed.bytes) tested.clear();
+	directed.clear(); undirected.clear();
+	return out.str();
+}
+
+//families of synthetic graphs, every graph is fixed by its family, number of vertices, density and seed
+const std::vector<std::string> FAMILIES = { "rmat", "erdos-renyi", "2vsb", "long-cycle", "deep-path" };
+
+//generates a synthetic graph of a family with about 'vertices' vertices ('rmat' rounds up to a power of two)
+CSRGraph generate(const std::string& family, const ll& vertices, const ll& density, const unsigned long long& seed) {
+	if (family == "rmat") {
+		ll scale = 0;
+		while ((1LL << scale) < vertices) scale++;
+		return rmatGraph(scale, density << scale, seed);
+	}
+	if (family == "erdos-renyi") return erdosRenyiGraph(vertices, density * vertices, seed);
+	if (family == "2vsb") return twoVertexStronglyBiconnectedGraph(vertices, (density - 2) * vertices, seed);
+	if (family == "long-cycle") return longCycleGraph(vertices);
+	return deepPathGraph(vertices);
+}
+
+//runs both dataset analyzers ('analyze' and 'analyzeCompressed') on tiny datasets whose largest SCC has fewer than three
+//vertices (a path, a single 2-cycle and a single vertex with a self-loop), none of them is 2-vertex strongly biconnected
+//returns the number of datasets reported or cached as 2-vertex strongly biconnected
+ll tinyCheck() {
+	const std::vector<std::string> datasets = { "1\t2\n2\t3\n", "1\t2\n2\t1\n", "1\t1\n" };
+	const std::string path = "differential.txt", cache_path = "differential.cache";
+	ll mismatches = 0;
+	for (auto& dataset : datasets) {
+		for (int compressed = 0; compressed < 2; compressed++) {
+			{
+				std::ofstream writer(path);
+				writer << "# Directed graph\n# Tiny\n# Nodes: 3 Edges: 2\n# FromNodeId\tToNodeId\n" << dataset;
+			}
+			std::remove(cache_path.c_str());
+			ResultCache cache(cache_path);
+			LoadedGraph graph{ path, false, nullptr, 0, {}, 0, 1, CompressedGraph() };
+			CachedResult result;
+			std::string report;
+			if (compressed) {
+				graph.loaded = readCompressed(path, graph.compressed, graph.labels, graph.hash);
+				graph.n = graph.compressed.n;
+				if (graph.loaded) report = analyzeCompressed(graph, cache);
+			}
+			else {
+				graph.loaded = readFile(path, graph.adjList, graph.n, graph.labels, graph.hash);
+				if (graph.loaded) report = analyze(graph, cache);
+			}
+			bool passed = graph.loaded && report.find("Graph is NOT 2-vertex strongly biconnected") != std::string::npos &&
+				(!cache.find(graph.hash, result) || !result.verdict);
+			if (!passed) {
+				mismatches++;
+				std::cout << "MISMATCH tiny dataset (" << (compressed ? "compressed" : "CSR") << "): 2-vertex strong biconnectivity of a "
+					<< graph.n << "-vertex graph\n";
+			}
 		}
-		std::cout << "Testing Strong Connectivity of Directed Graph...\n";
-		auto start = high_resolution_clock::now();
-		ll* components = gabow(adjList, n);
-		if (!isStronglyConnected(components, n)) {
-			std::cout << "-> Maximum SCC is being considered...\n";
-			auto largestSCC = extractLargestSCC(adjList, n, components);
-			adjList = largestSCC.first; n = largestSCC.second;
+	}
+	std::remove(path.c_str());
+	std::remove(cache_path.c_str());
+	return mismatches;
+}
+
+//runs the CSR engines against the LinkedList implementation on small synthetic graphs
+//returns the number of mismatches
+ll check(const ll& graphs, const unsigned long long& seed) {
+	std::mt19937_64 rng(seed);
+	ll mismatches = 0, legacy_mismatches = 0;
+	for (ll k = 0; k < graphs; k++) {
+		std::string family = FAMILIES[k % FAMILIES.size()];
+		ll vertices = 3 + rng() % 30, density = 2 + rng() % 5;
+		unsigned long long graph_seed = rng();
+		CSRGraph graph = generate(family, vertices, density, graph_seed);
+		mismatches += differentialCheck(graph, family + " (n=" + std::to_string(graph.n) + ", seed=" + std::to_string(graph_seed) + ")",
+			legacy_mismatches, std::cout);
+		graph.clear();
+	}
+	mismatches += tinyCheck();
+	std::cout << "Checked " << graphs << " graphs: " << mismatches << " mismatches\n";
+	std::cout << "LinkedList 'isBiconnected' disagreed with the reference on " << legacy_mismatches << " graphs\n";
+	return mismatches;
+}
+
+//times the CSR engines on synthetic graphs of growing size (2^10 to 2^max_scale vertices)
+//strong connectivity is timed both with 'gabow' and with forward/backward reachability on the reverse graph
+//the O(n(n+m)) sweep is only timed up to 2^12 vertices
+//memory is reported in bytes per edge for the directed graph plus its underlying graph, as CSRGraph and as CompressedGraph
+void bench(const ll& max_scale, const unsigned long long& seed) {
+	const ll density = 8;
+	std::cout << "family\tn\tm\tgabow_ms\treach_ms\tundirected_ms\tjens_ms\tsweep_ms\tverdict\tcsr_bytes\tcompressed_bytes\tcompressed_gabow_ms\tcompressed_jens_ms\n";
+	for (auto& family : FAMILIES) {
+		for (ll scale = 10; scale <= max_scale; scale++) {
+			CSRGraph graph = generate(family, 1LL << scale, density, seed + scale);
+			CSRGraph reversed = reverseCSR(graph);
+			auto r0 = high_resolution_clock::now();
+			bool reachable = isStronglyConnected(graph, reversed);
+			auto r1 = high_resolution_clock::now();
+			auto t0 = high_resolution_clock::now();
+			bool strongly_connected = isStronglyConnected(graph);
+			auto t1 = high_resolution_clock::now();
+			if (reachable != strongly_connected) std::cout << "MISMATCH " << family << ": strong connectivity\n";
+			CSRGraph undirected = makeUndirected(graph, std::max(1u, std::thread::hardware_concurrency()));
+			auto t2 = high_resolution_clock::now();
+			bool biconnected = isBiconnected(undirected);
+			auto t3 = high_resolution_clock::now();
+			std::string sweep_ms = "-", verdict = "NO";
+			if (strongly_connected && biconnected && scale <= 12) {
+				std::ostringstream progress;
+				bool success = (sweep(graph, reversed, undirected, 0, 0, "", 0, progress) == -1);
+				duration<double, std::milli> d = high_resolution_clock::now() - t3;
+				sweep_ms = std::to_string(d.count());
+				verdict = success ? "YES" : "NO";
+			}
+			else if (strongly_connected && biconnected) verdict = "?";
+			duration<double, std::milli> d1 = t1 - t0, d2 = t2 - t1, d3 = t3 - t2, d6 = r1 - r0;
+			CompressedGraph compressed = compress(graph);
+			CompressedGraph compressed_undirected = makeUndirected(compressed);
+			auto t4 = high_resolution_clock::now();
+			isStronglyConnected(compressed);
+			auto t5 = high_resolution_clock::now();
+			isBiconnected(compressed_undirected);
+			auto t6 = high_resolution_clock::now();
+			duration<double, std::milli> d4 = t5 - t4, d5 = t6 - t5;
+			double edges = double(graph.m > 0 ? graph.m : 1);
+			double csr_bytes = double((graph.n + 1 + graph.m + undirected.n + 1 + undirected.m) * sizeof(ll)) / edges;
+			double compressed_bytes = double(compressed.memory() + compressed_undirected.memory()) / edges;
+			std::cout << family << '\t' << graph.n << '\t' << graph.m << '\t' << d1.count() << '\t' << d6.count() << '\t' << d2.count() << '\t'
+				<< d3.count() << '\t' << sweep_ms << '\t' << verdict << '\t' << csr_bytes << '\t' << compressed_bytes << '\t'
+				<< d4.count() << '\t' << d5.count() << '\n' << std::flush;
+			graph.clear(); reversed.clear(); undirected.clear(); compressed.clear(); compressed_undirected.clear();
 		}
-		auto end = high_resolution_clock::now();
-		std::cout << "Testing Two-Connectivity of Underlying Graph...\n";
-		auto start2 = high_resolution_clock::now();
-		makeUndirected(adjList, n);
-		if (!isBiconnected(adjList, n)) {
-			auto end2 = high_resolution_clock::now();
-			duration<double, std::milli> d1 = end - start;
-			duration<double, std::milli> d2 = end2 - start2;
-			std::cout << "Result: Graph is NOT 2-vertex strongly biconnected!\n";
-			std::cout << "Gabow Time: " << d1.count() << "ms\n";
-			std::cout << "Jens Time: " << d2.count() << "ms\n\n";
-			continue;
+	}
+}
+
+//answers queries about deleting vertex sets from one dataset, read from standard input until its end
+//every line is a query "sc|sb|2vsb [id1 id2 ...]" about the graph without the listed dataset ids
+//queries of an unknown kind, with ids that are not in the graph or with malformed ids are reported and skipped
+//all other queries are answered as one batch by a single GraphAnalyzer session, one "<query>: YES|NO" per line
+//returns false if the dataset could not be loaded
+bool query(const std::string& file_path, const ll& threads) {
+	auto t0 = high_resolution_clock::now();
+	GraphAnalyzer analyzer(file_path, threads);
+	if (!analyzer.loaded()) {
+		std::cout << "Error: could not load " << file_path << "\n";
+		return false;
+	}
+	auto t1 = high_resolution_clock::now();
+	duration<double, std::milli> d = t1 - t0;
+	std::cout << "Loaded " << analyzer.vertices() << " vertices in " << d.count() << "ms\n";
+	std::vector<Query> queries;
+	std::vector<std::vector<ll>> sets;
+	std::vector<std::string> texts; //the line of each answered query
+	std::string line;
+	while (std::getline(std::cin, line)) {
+		std::istringstream reader(line);
+		std::string kind;
+		if (!(reader >> kind)) continue;
+		if (kind == "sc") queries.push_back(Query::StronglyConnected);
+		else if (kind == "sb") queries.push_back(Query::StronglyBiconnected);
+		else if (kind == "2vsb") queries.push_back(Query::TwoVertexStronglyBiconnected);
+		else { std::cout << "Skipped unknown query: " << kind << "\n"; continue; }
+		std::vector<ll> S, unknown;
+		ll label;
+		while (reader >> label) {
+			ll v = analyzer.vertex(label);
+			if (v != -1) S.push_back(v);
+			else unknown.push_back(label);
 		}
-		auto end2 = high_resolution_clock::now();
-		std::cout << "Bruteforcing... (2-vertex strong biconnectivity candidate)\n";
-		bool success = true;
-		for (ll j = 0; j < n; j++) {
-			LinkedList<ll>* test = adjList;
-			ll vertices = n;
-			removeVertex(test, vertices, j);
-			if (!isBiconnected(test, vertices)) { success = false; break; }
-			if (j % 1000 == 0) std::cout << std::setprecision(2) << (double(j) * 100) / n << "% Complete\n";
+		if (!reader.eof()) { std::cout << "Skipped malformed query: " << line << "\n"; queries.pop_back(); continue; }
+		if (!unknown.empty()) {
+			std::cout << "Skipped query with ids not in the graph:";
+			for (auto& i : unknown) std::cout << ' ' << i;
+			std::cout << " (" << line << ")\n";
+			queries.pop_back();
+			continue;
 		}
-		if (success) std::cout << "100% Complete: Graph is 2-vertex strongly biconnected!\n";
-		else std::cout << "100% Complete: Graph is NOT 2-vertex strongly biconnected!\n";
-		duration<double, std::milli> d1 = end - start;
-		duration<double, std::milli> d2 = end2 - start2;
-		std::cout << "Gabow Time: " << d1.count() << "ms\n";
-		std::cout << "Jens Time: " << d2.count() << "ms\n\n";
+		sets.push_back(S);
+		texts.push_back(line);
+	}
+	t0 = high_resolution_clock::now();
+	std::vector<bool> results = analyzer.batch(queries, sets);
+	t1 = high_resolution_clock::now();
+	for (size_t i = 0; i < results.size(); i++) std::cout << texts[i] << ": " << (results[i] ? "YES" : "NO") << "\n";
+	d = t1 - t0;
+	std::cout << "Answered " << results.size() << " queries in " << d.count() << "ms\n";
+	return true;
+}
+
+//usage: main [threads] [queue capacity] [cache file]
+//       main --compressed [threads] [queue capacity] [cache file]
+//       main --check [graphs] [seed]
+//       main --bench [max scale] [seed]
+//       main --query <dataset file> [threads] < queries
+//datasets are loaded while earlier ones are analyzed, reports are printed in order of completion
+int main(int argc, char** argv) {
+	if (argc > 1 && std::string(argv[1]) == "--check") {
+		ll graphs = (argc > 2) ? std::stoll(argv[2]) : 500;
+		unsigned long long seed = (argc > 3) ? std::stoull(argv[3]) : 1;
+		return check(graphs, seed) == 0 ? 0 : 1;
+	}
+	if (argc > 1 && std::string(argv[1]) == "--bench") {
+		ll max_scale = (argc > 2) ? std::stoll(argv[2]) : 16;
+		unsigned long long seed = (argc > 3) ? std::stoull(argv[3]) : 1;
+		bench(max_scale, seed);
+		std::cout << memoryReport();
+		return 0;
+	}
+	if (argc > 2 && std::string(argv[1]) == "--query") {
+		ll threads = (argc > 3) ? std::stoll(argv[3]) : 1;
+		return query(argv[2], threads) ? 0 : 1;
 	}
+	bool compressed = (argc > 1 && std::string(argv[1]) == "--compressed"); //datasets are read and analyzed as CompressedGraph
+	int first = compressed ? 2 : 1; //the first positional argument
+	ll threads = std::max(2u, std::thread::hardware_concurrency());
+	ll capacity = 2;
+	std::string cache_path = "results.cache";
+	if (argc > first) threads = std::stoll(argv[first]);
+	if (argc > first + 1) capacity = std::stoll(argv[first + 1]);
+	if (argc > first + 2) cache_path = argv[first + 2];
+	ResultCache cache(cache_path);
+	std::cout << "Processing " << SNAP::datasets.size() << " datasets with " << threads << " threads" << (compressed ? " (compressed)" : "") << "...\n\n";
+	runPipeline(SNAP::directory, SNAP::datasets, threads, capacity, [&](LoadedGraph& graph) {
+		return compressed ? analyzeCompressed(graph, cache) : analyze(graph, cache);
+	}, compressed);
+	std::cout << memoryReport();
 	return 0;
 }
\ No newline at end of file